@@ -153,6 +153,7 @@ void BaseObjectView::resizePolygon(QPolygonF &pol, float width, float height)
 
 void BaseObjectView::loadObjectsStyle(void)
 {
+	XMLParser xmlparser;
 	QColor *colors=NULL;
 	QTextCharFormat font_fmt;
 	QFont font;
@@ -165,23 +166,23 @@ void BaseObjectView::loadObjectsStyle(void)
 
 	try
 	{
-		XMLParser::restartParser();
-		XMLParser::setDTDFile(GlobalAttributes::CONFIGURATIONS_DIR +
+		xmlparser.restartParser();
+		xmlparser.setDTDFile(GlobalAttributes::CONFIGURATIONS_DIR +
 													GlobalAttributes::DIR_SEPARATOR +
 													GlobalAttributes::OBJECT_DTD_DIR +
 													GlobalAttributes::DIR_SEPARATOR +
 													GlobalAttributes::OBJECTS_STYLE_CONF +
 													GlobalAttributes::OBJECT_DTD_EXT, GlobalAttributes::OBJECTS_STYLE_CONF);
-		XMLParser::loadXMLFile(config_file);
+		xmlparser.loadXMLFile(config_file);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					XMLParser::getElementAttributes(attribs);
-					elem=XMLParser::getElementName();
+					xmlparser.getElementAttributes(attribs);
+					elem=xmlparser.getElementName();
 
 					if(elem==ParsersAttributes::GLOBAL)
 					{
@@ -215,7 +216,7 @@ void BaseObjectView::loadObjectsStyle(void)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
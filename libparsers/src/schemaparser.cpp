@@ -29,22 +29,129 @@ const QString SchemaParser::PGSQL_VERSION_84="8.4";
 const QString SchemaParser::PGSQL_VERSION_90="9.0";
 const QString SchemaParser::PGSQL_VERSION_91="9.1";
 
-vector<QString> SchemaParser::buffer;
-QString SchemaParser::filename="";
-unsigned SchemaParser::line=0;
-unsigned SchemaParser::column=0;
-unsigned SchemaParser::comment_count=0;
-bool SchemaParser::ignore_unk_atribs=false;
+map<QString, QSharedPointer<CompiledSchema> > SchemaParser::compiled_schemas;
+map<QString, QString> SchemaParser::sql_schema_files;
+QString SchemaParser::sql_files_version="";
+QMutex SchemaParser::shared_mutex;
+QThreadStorage<SchemaParser *> SchemaParser::default_parsers;
 
 QString SchemaParser::pgsql_version=SchemaParser::PGSQL_VERSION_91;
 
+SchemaParser::SchemaParser(void)
+{
+	ignore_unk_atribs=false;
+	line=column=comment_count=0;
+}
+
+SchemaParser *SchemaParser::getDefaultParser(void)
+{
+	//Each thread has its own default parser which is destroyed when the thread finishes
+	if(!default_parsers.hasLocalData())
+		default_parsers.setLocalData(new SchemaParser);
+
+	return(default_parsers.localData());
+}
+
 void SchemaParser::setPgSQLVersion(const QString &pgsql_version)
 {
+	QMutexLocker locker(&shared_mutex);
+
 	SchemaParser::pgsql_version=pgsql_version;
+
+	if(sql_files_version!=pgsql_version)
+		resolveSQLSchemaFiles();
+}
+
+void SchemaParser::resolveSQLSchemaFiles(void)
+{
+	QString sql_dir, dirs[2];
+	QStringList files;
+	QDir directory;
+	unsigned i;
+	int count, i1;
+
+	sql_dir=GlobalAttributes::SCHEMAS_ROOT_DIR + GlobalAttributes::DIR_SEPARATOR +
+					GlobalAttributes::SQL_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR;
+
+	sql_schema_files.clear();
+
+	/* The common directory is listed first so the files on the version directory
+		replaces the common ones */
+	dirs[0]=sql_dir + GlobalAttributes::COMMON_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR;
+	dirs[1]=sql_dir + pgsql_version + GlobalAttributes::DIR_SEPARATOR;
+
+	for(i=0; i < 2; i++)
+	{
+		directory=QDir(dirs[i]);
+
+		/* Inexistent directories are ignored, the objects without a schema file will
+		 have the error raised when the parser tries to load the file */
+		if(directory.exists())
+		{
+			files=directory.entryList(QStringList("*" + GlobalAttributes::SCHEMA_EXT), QDir::Files);
+
+			count=files.count();
+			for(i1=0; i1 < count; i1++)
+				sql_schema_files[QFileInfo(files[i1]).completeBaseName()]=dirs[i] + files[i1];
+		}
+	}
+
+	sql_files_version=pgsql_version;
+}
+
+void SchemaParser::compileSchemaFile(const QString &file)
+{
+	try
+	{
+		getDefaultParser()->getCompiledSchema(file);
+	}
+	catch(Exception &)
+	{
+		//Invalid files are not stored on the cache so the error is raised again when the file is used
+	}
+}
+
+void SchemaParser::precompileSchemas(void)
+{
+	QString sql_dir;
+	QStringList dirs, files, dir_files;
+	vector<QString> versions;
+	QDir directory;
+	unsigned i;
+	int count, i1;
+
+	sql_dir=GlobalAttributes::SCHEMAS_ROOT_DIR + GlobalAttributes::DIR_SEPARATOR +
+					GlobalAttributes::SQL_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR;
+
+	dirs.push_back(GlobalAttributes::SCHEMAS_ROOT_DIR + GlobalAttributes::DIR_SEPARATOR +
+								 GlobalAttributes::XML_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR);
+
+	if(QDir(sql_dir).exists())
+	{
+		dirs.push_back(sql_dir + GlobalAttributes::COMMON_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR);
+
+		getPgSQLVersions(versions);
+		for(i=0; i < versions.size(); i++)
+			dirs.push_back(sql_dir + versions[i] + GlobalAttributes::DIR_SEPARATOR);
+	}
+
+	//Lists the schema files of all directories
+	count=dirs.count();
+	for(i1=0; i1 < count; i1++)
+	{
+		directory=QDir(dirs[i1]);
+		dir_files=directory.entryList(QStringList("*" + GlobalAttributes::SCHEMA_EXT), QDir::Files);
+
+		for(i=0; i < static_cast<unsigned>(dir_files.count()); i++)
+			files.push_back(dirs[i1] + dir_files[i]);
+	}
+
+	QtConcurrent::blockingMap(files, SchemaParser::compileSchemaFile);
 }
 
 QString SchemaParser::getPgSQLVersion(void)
 {
+	QMutexLocker locker(&shared_mutex);
 	return(SchemaParser::pgsql_version);
 }
 
@@ -89,6 +196,11 @@ void SchemaParser::getPgSQLVersions(vector<QString> &versions)
 }
 
 void SchemaParser::restartParser(void)
+{
+	getDefaultParser()->reset();
+}
+
+void SchemaParser::reset(void)
 {
 	/* Clears the buffer and resets the counters for line,
 		column and amount of comments */
@@ -115,7 +227,7 @@ void SchemaParser::loadFile(const QString &file)
 		}
 
 		//Prepares the parser to do new reading
-		restartParser();
+		reset();
 
 		//While the input file doesn't reach the end
 		while(!input.eof())
@@ -157,6 +269,110 @@ void SchemaParser::loadFile(const QString &file)
 	}
 }
 
+QSharedPointer<CompiledSchema> SchemaParser::getCompiledSchema(const QString &file)
+{
+	map<QString, QSharedPointer<CompiledSchema> >::iterator itr;
+	QSharedPointer<CompiledSchema> schema;
+
+	shared_mutex.lock();
+	itr=compiled_schemas.find(file);
+
+	if(itr!=compiled_schemas.end())
+		schema=itr->second;
+
+	shared_mutex.unlock();
+
+	/* Only reads the file if it was not compiled yet. The compilation is made without
+		holding the mutex so other threads can use the already compiled schemas */
+	if(schema.isNull())
+	{
+		SchemaToken token;
+		map<QString, int> slots;
+		char chr;
+
+		schema=QSharedPointer<CompiledSchema>(new CompiledSchema);
+
+		loadFile(file);
+
+		while(line < buffer.size())
+		{
+			chr=buffer[line][column].toAscii();
+			token.slot=-1;
+
+			switch(chr)
+			{
+				/* Increments the number of rows causing the parser
+				 to get the next line buffer for analysis */
+				case CHR_LINE_END:
+					line++;
+					column=0;
+				break;
+
+				case CHR_SPACE:
+					//The parser will ignore the spaces that are not within pure texts
+					while(buffer[line][column]==CHR_SPACE) column++;
+				break;
+
+				case CHR_INI_METACHAR:
+					token.type=SchemaToken::TK_METACHARACTER;
+					token.value=getMetaCharacter();
+				break;
+
+				case CHR_INI_ATTRIB:
+				case CHR_MID_ATTRIB:
+				case CHR_END_ATTRIB:
+					token.type=SchemaToken::TK_ATTRIBUTE;
+					token.value=getAttribute();
+
+					//Binds the token to the attribute's slot creating it when the attribute is referenced for the first time
+					if(slots.count(token.value)==0)
+					{
+						slots[token.value]=schema->attributes.size();
+						schema->attributes.push_back(token.value);
+					}
+
+					token.slot=slots[token.value];
+				break;
+
+				case CHR_INI_CONDITIONAL:
+					token.type=SchemaToken::TK_CONDITIONAL;
+					token.value=getConditional();
+				break;
+
+				default:
+					token.type=SchemaToken::TK_TEXT;
+
+					if(chr==CHR_INI_PURETEXT ||
+						 chr==CHR_END_PURETEXT)
+						token.value=getPureText();
+					else
+						token.value=getWord();
+				break;
+			}
+
+			//Line breaks and spaces outside pure texts does not generate tokens
+			if(chr!=CHR_LINE_END && chr!=CHR_SPACE)
+			{
+				token.line=line;
+				token.column=column;
+				schema->tokens.push_back(token);
+			}
+		}
+
+		schema->comment_count=comment_count;
+		schema->end_line=line;
+		schema->end_column=column;
+		reset();
+
+		//If another thread compiled the same file meanwhile the first compiled one is kept
+		shared_mutex.lock();
+		schema=compiled_schemas.insert(make_pair(file, schema)).first->second;
+		shared_mutex.unlock();
+	}
+
+	return(schema);
+}
+
 QString SchemaParser::getAttribute(void)
 {
 	QString atrib, current_line, str_aux;
@@ -370,6 +586,16 @@ QString SchemaParser::getMetaCharacter(void)
 	return(meta);
 }
 
+QChar SchemaParser::convertMetaCharacter(const QString &meta)
+{
+	if(meta==TOKEN_META_SP)
+		return(QChar(CHR_SPACE));
+	else if(meta==TOKEN_META_TB)
+		return(QChar(CHR_TABULATION));
+	else
+		return(QChar(CHR_LINE_END));
+}
+
 bool SchemaParser::isSpecialCharacter(char chr)
 {
 	return(chr==CHR_INI_ATTRIB || chr==CHR_MID_ATTRIB ||
@@ -378,7 +604,17 @@ bool SchemaParser::isSpecialCharacter(char chr)
 				 chr==CHR_END_PURETEXT);
 }
 
-QString SchemaParser::getCodeDefinition(const QString & obj_name, map<QString, QString> &attributes, unsigned def_type)
+QString SchemaParser::getCodeDefinition(const QString &obj_name, map<QString, QString> &attributes, unsigned def_type)
+{
+	return(getDefaultParser()->getObjectDefinition(obj_name, attributes, def_type));
+}
+
+QString SchemaParser::getCodeDefinition(const QString &filename, map<QString, QString> &attributes)
+{
+	return(getDefaultParser()->getFileDefinition(filename, attributes));
+}
+
+QString SchemaParser::getObjectDefinition(const QString &obj_name, map<QString, QString> &attributes, unsigned def_type)
 {
 	if(obj_name!="")
 	{
@@ -386,100 +622,109 @@ QString SchemaParser::getCodeDefinition(const QString & obj_name, map<QString, Q
 
 		if(def_type==SQL_DEFINITION)
 		{
-			try
-			{
-				//Formats the filename
-				filename=GlobalAttributes::SCHEMAS_ROOT_DIR + GlobalAttributes::DIR_SEPARATOR +
-								 GlobalAttributes::SQL_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR + pgsql_version +
-								 GlobalAttributes::DIR_SEPARATOR + obj_name + GlobalAttributes::SCHEMA_EXT;
+			map<QString, QString>::iterator itr;
 
-				//Try to get the object definitin from the specified path
-				return(getCodeDefinition(filename, attributes));
-			}
-			catch(Exception &e)
-			{
-				/* If detected the error that the file was not found, the parser
-			 try to fetch the file in the common schema for all versions
-			 postgresql */
+			shared_mutex.lock();
+
+			//Builds the schema files table in case the version was not configured by setPgSQLVersion()
+			if(sql_files_version!=pgsql_version)
+				resolveSQLSchemaFiles();
 
-				//If the exception is of another type than 'file not loaded' redirects error
-				if(e.getErrorType()!=ERR_FILE_DIR_NOT_ACCESSED)
-					throw Exception(e.getErrorMessage(),e.getErrorType(),
-													__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+			itr=sql_schema_files.find(obj_name);
 
-				//Reconfigure the name of the file to point to the default directory
+			if(itr!=sql_schema_files.end())
+				filename=itr->second;
+			else
+				/* If the object has no schema file on the version or common directories the path
+				 to the common directory is used so the parser raises the error of file not found */
 				filename=GlobalAttributes::SCHEMAS_ROOT_DIR + GlobalAttributes::DIR_SEPARATOR +
 								 GlobalAttributes::SQL_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR +
 								 GlobalAttributes::COMMON_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR +
 								 obj_name + GlobalAttributes::SCHEMA_EXT;
 
-				return(getCodeDefinition(filename, attributes));
-			}
+			shared_mutex.unlock();
+			return(getFileDefinition(filename, attributes));
 		}
 		else
 		{
 			filename=GlobalAttributes::SCHEMAS_ROOT_DIR + GlobalAttributes::DIR_SEPARATOR +
 							 GlobalAttributes::XML_SCHEMA_DIR + GlobalAttributes::DIR_SEPARATOR + obj_name +
 							 GlobalAttributes::SCHEMA_EXT;
-			return(getCodeDefinition(filename, attributes));
+			return(getFileDefinition(filename, attributes));
 		}
 	}
 	else return("");
 }
 
 void SchemaParser::setIgnoreUnkownAttributes(bool ignore)
+{
+	getDefaultParser()->setIgnoreUnknownAttribs(ignore);
+}
+
+void SchemaParser::setIgnoreUnknownAttribs(bool ignore)
 {
 	ignore_unk_atribs=ignore;
 }
 
-QString SchemaParser::getCodeDefinition(const QString &filename, map<QString,QString> &attributes)
+QString SchemaParser::getFileDefinition(const QString &filename, map<QString,QString> &attributes)
 {
 	QString object_def;
 
 	if(filename!="")
 	{
-		unsigned end_cnt, if_cnt;
+		unsigned end_cnt, if_cnt, tk_idx, tk_count, i;
 		int if_level, prev_if_level;
-		QString atrib, cond, prev_cond, word, meta, str_aux;
+		QString atrib, cond, prev_cond, meta, str_aux;
 		bool error, if_attrib;
-		char chr;
 		vector<bool> vet_expif, vet_tk_if, vet_tk_then, vet_tk_else;
-		map<int, vector<QString> > if_map, else_map;
-		vector<QString>::iterator itr, itr_end;
+		map<int, vector<const SchemaToken *> > if_map, else_map;
+		vector<const SchemaToken *>::iterator itr, itr_end;
 		vector<int> vet_prev_level;
-		vector<QString> *vet_aux;
+		vector<const SchemaToken *> *vet_aux;
+		vector<QString *> frame;
+		map<QString, QString>::iterator attr_itr;
+		QString *value=NULL;
+		QSharedPointer<CompiledSchema> schema;
+		const SchemaToken *token=NULL, *word_tk=NULL;
+
+		this->filename=filename;
+		schema=getCompiledSchema(filename);
+		comment_count=schema->comment_count;
+		tk_count=schema->tokens.size();
+
+		/* Fills the attributes frame: the values of the attributes referenced by the file are searched only once
+		 on the passed map and accessed by the tokens through the slots bound during the compilation. Unknown
+		 attributes have no value on the frame and are treated when the token that references them is reached */
+		frame.resize(schema->attributes.size(), NULL);
+		for(i=0; i < schema->attributes.size(); i++)
+		{
+			attr_itr=attributes.find(schema->attributes[i]);
 
-		SchemaParser::filename=filename;
-		loadFile(filename);
+			if(attr_itr!=attributes.end())
+				frame[i]=&attr_itr->second;
+		}
 
-		//In case the file was successfuly loaded
-		if(buffer.size() > 0)
+		//In case the file has tokens to be analyzed
+		if(tk_count > 0)
 		{
 			//Init the control variables
 			error=if_attrib=false;
 			if_level=-1;
 			end_cnt=if_cnt=0;
 
-			while(line < buffer.size())
+			for(tk_idx=0; tk_idx < tk_count; tk_idx++)
 			{
-				chr=buffer[line][column].toAscii();
-				switch(chr)
-				{
-					/* Increments the number of rows causing the parser
-			 to get the next line buffer for analysis */
-					case CHR_LINE_END:
-						line++;
-						column=0;
-					break;
+				token=&schema->tokens[tk_idx];
 
-					case CHR_SPACE:
-						//The parser will ignore the spaces that are not within pure texts
-						while(buffer[line][column]==CHR_SPACE) column++;
-					break;
+				//Positions the parser right after the token in order to reference it on error messages
+				line=token->line;
+				column=token->column;
 
+				switch(token->type)
+				{
 						//Metacharacter extraction
-					case CHR_INI_METACHAR:
-						meta=getMetaCharacter();
+					case SchemaToken::TK_METACHARACTER:
+						meta=token->value;
 
 						//Checks whether the extracted token is valid metacharacter
 						if(meta!=TOKEN_META_SP && meta!=TOKEN_META_TB &&
@@ -501,14 +746,6 @@ QString SchemaParser::getCodeDefinition(const QString &filename, map<QString,QSt
 						}
 						else
 						{
-							//Converting the metacharacter drawn to the character that represents this
-							if(meta==TOKEN_META_SP) chr=CHR_SPACE;
-							else if(meta==TOKEN_META_TB) chr=CHR_TABULATION;
-							else chr=CHR_LINE_END;
-
-							meta="";
-							meta+=chr;
-
 							//If the parser is inside an 'if / else' extracting tokens
 							if(if_level>=0)
 							{
@@ -517,29 +754,28 @@ QString SchemaParser::getCodeDefinition(const QString &filename, map<QString,QSt
 								if(vet_tk_if[if_level] &&
 									 vet_tk_then[if_level] &&
 									 !vet_tk_else[if_level])
-									if_map[if_level].push_back(meta);
+									if_map[if_level].push_back(token);
 
 								/* If the parser is in 'else' section,
 									 places the metacharacter on the word map of the current 'else'*/
 								else if(vet_tk_else[if_level])
-									else_map[if_level].push_back(meta);
+									else_map[if_level].push_back(token);
 							}
 							else
-								/* If the parsers is not in a 'if / else', puts the metacharacter
-									 in the definition sql */
-								object_def+=meta;
+								/* If the parsers is not in a 'if / else', puts the character represented
+									 by the metacharacter in the definition sql */
+								object_def+=convertMetaCharacter(meta);
 						}
 
 					break;
 
 						//Attribute extraction
-					case CHR_INI_ATTRIB:
-					case CHR_MID_ATTRIB:
-					case CHR_END_ATTRIB:
-						atrib=getAttribute();
+					case SchemaToken::TK_ATTRIBUTE:
+						atrib=token->value;
+						value=frame[token->slot];
 
 						//Checks if the attribute extracted belongs to the passed list of attributes
-						if(attributes.count(atrib)==0)
+						if(!value)
 						{
 							if(!ignore_unk_atribs)
 							{
@@ -548,7 +784,10 @@ QString SchemaParser::getCodeDefinition(const QString &filename, map<QString,QSt
 								throw Exception(str_aux,ERR_UNK_ATTRIBUTE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 							}
 							else
+							{
 								attributes[atrib]="";
+								value=frame[token->slot]=&attributes[atrib];
+							}
 						}
 
 						//If the parser is inside an 'if / else' extracting tokens
@@ -562,7 +801,7 @@ QString SchemaParser::getCodeDefinition(const QString &filename, map<QString,QSt
 								if_attrib=true;
 
 								//Checks if the attribute value is empty. If not evaluates as true the conditional expression
-								vet_expif.push_back((attributes[atrib]!=""));
+								vet_expif.push_back((*value!=""));
 							}
 
 							/* If the parser is in the part of the 'if' expression and yet
@@ -577,27 +816,20 @@ QString SchemaParser::getCodeDefinition(const QString &filename, map<QString,QSt
 							}
 							else
 							{
-								word=atrib;
-								atrib="";
-								atrib+=CHR_INI_ATTRIB;
-								atrib+=CHR_MID_ATTRIB;
-								atrib+=word;
-								atrib+=CHR_END_ATTRIB;
-
 								//If the parser is in the 'if' section
 								if(vet_tk_if[if_level] &&
 									 vet_tk_then[if_level] &&
 									 !vet_tk_else[if_level])
-									//Inserts the attribute value in the map of the words of current the 'if' section
-									if_map[if_level].push_back(atrib);
+									//Inserts the attribute in the map of the words of current the 'if' section
+									if_map[if_level].push_back(token);
 								else if(vet_tk_else[if_level])
-									//Inserts the attribute value in the map of the words of current the 'else' section
-									else_map[if_level].push_back(atrib);
+									//Inserts the attribute in the map of the words of current the 'else' section
+									else_map[if_level].push_back(token);
 							}
 						}
 						else
 						{
-							if(attributes[atrib]=="")
+							if(*value=="")
 							{
 								str_aux=QString(Exception::getErrorMessage(ERR_UNDEF_ATTRIB_VALUE))
 												.arg(atrib).arg(filename).arg(line + comment_count +1).arg(column+1);
@@ -607,14 +839,14 @@ QString SchemaParser::getCodeDefinition(const QString &filename, map<QString,QSt
 
 							/* If the parser is not in an if / else, concatenates the value of the attribute
 								directly in definition in sql */
-							object_def+=attributes[atrib];
+							object_def+=(*value);
 						}
 					break;
 
 						//Conditional instruction extraction
-					case CHR_INI_CONDITIONAL:
+					case SchemaToken::TK_CONDITIONAL:
 						prev_cond=cond;
-						cond=getConditional();
+						cond=token->value;
 
 						//Checks whether the extracted token is a valid conditional
 						if(cond!=TOKEN_IF && cond!=TOKEN_ELSE &&
@@ -718,27 +950,30 @@ QString SchemaParser::getCodeDefinition(const QString &filename, map<QString,QSt
 										vet_aux->push_back((*itr));
 									else
 									{
-										word=(*itr);
+										word_tk=(*itr);
 
-										//Check if the work is not an attribute
-										if(word[0]==CHR_INI_ATTRIB)
+										//Check if the word is an attribute
+										if(word_tk->type==SchemaToken::TK_ATTRIBUTE)
 										{
-											/* If its an attribute, extracts the name and checks if the same
-											has empty value */
-											atrib=word.mid(2,word.size()-3);
-											word=attributes[atrib];
+											//If its an attribute, checks if the same has empty value
+											atrib=word_tk->value;
+											value=frame[word_tk->slot];
 
 											//If the attribute has no value set raises an exception
-											if(word=="")
+											if(*value=="")
 											{
 												str_aux=QString(Exception::getErrorMessage(ERR_UNDEF_ATTRIB_VALUE))
 																.arg(atrib).arg(filename).arg(line + comment_count +1).arg(column+1);
 												throw Exception(str_aux,ERR_UNDEF_ATTRIB_VALUE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 											}
-										}
 
-										//Else, insert the work directly on the object definition
-										object_def+=word;
+											object_def+=(*value);
+										}
+										else if(word_tk->type==SchemaToken::TK_METACHARACTER)
+											object_def+=convertMetaCharacter(word_tk->value);
+										else
+											//Else, insert the word directly on the object definition
+											object_def+=word_tk->value;
 									}
 									itr++;
 								}
@@ -790,11 +1025,6 @@ QString SchemaParser::getCodeDefinition(const QString &filename, map<QString,QSt
 
 						//Extraction of pure text or simple words
 					default:
-						if(chr==CHR_INI_PURETEXT ||
-							 chr==CHR_END_PURETEXT)
-							word=getPureText();
-						else
-							word=getWord();
 
 						//Case the parser is in 'if/else'
 						if(if_level>=0)
@@ -812,18 +1042,21 @@ QString SchemaParser::getCodeDefinition(const QString &filename, map<QString,QSt
 											vet_tk_then[if_level] &&
 											!vet_tk_else[if_level])
 								//Inserts the word on the words map extracted on 'if' section
-								if_map[if_level].push_back(word);
+								if_map[if_level].push_back(token);
 							else if(vet_tk_else[if_level])
 								//Inserts the word on the words map extracted on 'else' section
-								else_map[if_level].push_back(word);
+								else_map[if_level].push_back(token);
 						}
 						else
 							//Case the parser is not in 'if/else' concatenates the word/text directly on the object definition
-							object_def+=word;
+							object_def+=token->value;
 					break;
 				}
 			}
 
+			line=schema->end_line;
+			column=schema->end_column;
+
 			/* If has more 'if' toknes than  'end' tokens, this indicates that some 'if' in code
 			was not closed thus the parser returns an error */
 			if(if_cnt!=end_cnt)
@@ -835,7 +1068,7 @@ QString SchemaParser::getCodeDefinition(const QString &filename, map<QString,QSt
 		}
 	}
 
-	restartParser();
+	reset();
 	ignore_unk_atribs=false;
 	return(object_def);
 }
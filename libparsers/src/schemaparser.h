@@ -32,12 +32,76 @@
 #include <map>
 #include <vector>
 #include <QDir>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QThreadStorage>
+#include <QtConcurrentMap>
 
+/*! \brief This class stores a token extracted from a schema file. The ordered list of tokens of
+ a file is its compiled form, that is reused on every code generation that uses that file */
+class SchemaToken {
+	protected:
+		//! \brief Token type (refer to TK_??? constants)
+		unsigned type;
+
+		//! \brief Token value (attribute name, conditional word, metacharacter or text)
+		QString value;
+
+		/*! \brief Line and column on the buffer right after the token extraction.
+		 These values are used to reference the token on error messages */
+		unsigned line, column;
+
+		/*! \brief Index of the attribute on the attributes table of the compiled schema.
+		 This value is used only by tokens of type TK_ATTRIBUTE */
+		int slot;
+
+	public:
+		static const unsigned TK_TEXT=0, //! \brief The token is a word or a pure text
+													TK_ATTRIBUTE=1, //! \brief The token is an attribute (@{name})
+													TK_CONDITIONAL=2, //! \brief The token is a conditional instruction (%if, %then, %else, %end)
+													TK_METACHARACTER=3; //! \brief The token is a metacharacter ($sp, $br, $tb)
+
+		SchemaToken(void)
+		{ type=TK_TEXT; line=column=0; slot=-1; }
+
+		friend class SchemaParser;
+};
+
+/*! \brief This class stores the compiled form of a schema file (its token list) in order to
+ avoid the file reading and tokenization on each code generation */
+class CompiledSchema {
+	protected:
+		//! \brief Tokens extracted from the file in the order they appear
+		vector<SchemaToken> tokens;
+
+		/*! \brief Names of the attributes referenced by the file. The attribute tokens are bound to this
+		 table (by index) during the compilation so each attribute is searched only once on the passed
+		 attributes map per code generation */
+		vector<QString> attributes;
+
+		//! \brief Amount of comment lines found on the file
+		unsigned comment_count,
+
+		//! \brief Line and column on the buffer where the tokenization stopped
+		end_line, end_column;
+
+	public:
+		CompiledSchema(void)
+		{ comment_count=end_line=end_column=0; }
+
+		friend class SchemaParser;
+};
+
+/*! \brief The parser can be instantiated so each thread can generate code definitions using its
+ own instance. The state of an analysis (buffer, line, column, etc) belongs to the instance while
+ the compiled schemas, the SQL schema files table and the PostgreSQL version are shared by all
+ instances (protected by a mutex). The static methods operates over a default instance that exists
+ for each thread, so the legacy static API can be safely called from different threads */
 class SchemaParser {
 	private:
 		/*! \brief Indicates that the parser should ignore unknown
 		 attributes avoiding raising exceptions */
-		static bool ignore_unk_atribs;
+		bool ignore_unk_atribs;
 
 		static const char CHR_COMMENT,			//! \brief Character that starts a comment
 											CHR_LINE_END,			//! \brief Character that indicates end of line
@@ -64,45 +128,85 @@ class SchemaParser {
 
 
 		//! \brief Loads a schema file and inserts its line in a buffer
-		static void loadFile(const QString &file);
+		void loadFile(const QString &file);
+
+		/*! \brief Loads and tokenizes the schema file storing the result on the compiled schemas cache.
+		 If the file was already compiled the cached version is returned */
+		QSharedPointer<CompiledSchema> getCompiledSchema(const QString &file);
 
 		//! \brief Get an attribute name from the buffer on the current position
-		static QString getAttribute(void);
+		QString getAttribute(void);
 
 		//! \brief Get an conditional instruction from the buffer on the current position
-		static QString getConditional(void);
+		QString getConditional(void);
 
 		//! \brief Get an metacharacter from the buffer on the current position
-		static QString getMetaCharacter(void);
+		QString getMetaCharacter(void);
 
 		/*! \brief Get an word from the buffer on the current position (word is any string that isn't
 		 a conditional instruction or comment) */
-		static QString getWord(void);
+		QString getWord(void);
 
 		//! \brief Gets a pure text, ignoring elements of the language
-		static QString getPureText(void);
+		QString getPureText(void);
 
 		/*! \brief Returns whether a character is special i.e. indicators of attributes
 		 or conditional instructions */
 		static bool isSpecialCharacter(char chr);
 
+		//! \brief Returns the character represented by the passed metacharacter ($sp, $tb or $br)
+		static QChar convertMetaCharacter(const QString &meta);
+
 		//! \brief Filename that was loaded by the parser
-		static QString filename;
+		QString filename;
 
 		/*! \brief Vectorial representation of the loaded file. This is the buffer that is
 		 analyzed by de parser */
-		static vector<QString> buffer;
+		vector<QString> buffer;
 
-		static unsigned line, //! \brief Current line where the parser reading is
-										column, //! \brief Current column where the parser reading is
+		unsigned line, //! \brief Current line where the parser reading is
+						 column, //! \brief Current column where the parser reading is
 
-										/*! \brief Comment line ammout extracted. This attribute is used to make the correct
-										 reference to the line on file that has syntax errors */
-										comment_count;
+						 /*! \brief Comment line ammout extracted. This attribute is used to make the correct
+							reference to the line on file that has syntax errors */
+						 comment_count;
 
-		//! \brief PostgreSQL version currently used by the parser
+		//! \brief PostgreSQL version currently used by the parsers
 		static QString pgsql_version;
 
+		/*! \brief Stores the compiled schema files. The key is the full path to the file
+		 which includes the PostgreSQL version directory for SQL schemas, so the compiled schemas
+		 of all versions can be kept at the same time and switching versions doesn't discard them.
+		 The schemas are never recompiled, so the application must be restarted to use schema files
+		 changed on disk */
+		static map<QString, QSharedPointer<CompiledSchema> > compiled_schemas;
+
+		/*! \brief Stores the full path to the SQL schema file of each object name for the
+		 current PostgreSQL version. When the version directory doesn't have a schema file
+		 for the object the path points to the file in the common directory */
+		static map<QString, QString> sql_schema_files;
+
+		//! \brief PostgreSQL version used to build the sql_schema_files table
+		static QString sql_files_version;
+
+		//! \brief Mutex that protects the attributes shared between all parser instances
+		static QMutex shared_mutex;
+
+		//! \brief Stores the default parser of each thread used by the static methods
+		static QThreadStorage<SchemaParser *> default_parsers;
+
+		/*! \brief Builds the SQL schema files table for the current PostgreSQL version listing the
+		 files on the common directory and on the version directory (the latter has precedence).
+		 This method must be called with the shared mutex locked */
+		static void resolveSQLSchemaFiles(void);
+
+		//! \brief Returns the default parser of the calling thread (creating it if needed)
+		static SchemaParser *getDefaultParser(void);
+
+		/*! \brief Compiles the passed schema file using the default parser of the calling thread.
+		 Errors are ignored since they are raised when the file is used to generate code */
+		static void compileSchemaFile(const QString &file);
+
 	public:
 
 		/*! \brief Constants used to refernce PostgreSQL versions. Created for convenience only
@@ -120,6 +224,22 @@ class SchemaParser {
 		static const unsigned SQL_DEFINITION=0,
 													XML_DEFINITION=1;
 
+		SchemaParser(void);
+
+		/*! \brief Returns the complete xml/sql definition for an database object represented by the
+		 map 'attributes' using the instance's analysis state. */
+		QString getObjectDefinition(const QString &obj_name, map<QString, QString> &attributes, unsigned def_type);
+
+		/*! \brief Returns the data of the schema file analyzed and filled with the values of the attributes
+		 map using the instance's analysis state. */
+		QString getFileDefinition(const QString &filename, map<QString, QString> &attributes);
+
+		//! \brief Set if the instance must ignore unknown attributes on the next analysis
+		void setIgnoreUnknownAttribs(bool ignore);
+
+		//! \brief Resets the instance in order to do new analysis
+		void reset(void);
+
 		/*! \brief Set the version of PostgreSQL to be adopted by the parser in obtaining
 		 the definition of the objects. This function should always be called at
 		 software startup or when the user wants to change the default version
@@ -146,6 +266,11 @@ class SchemaParser {
 		//! \brief Resets the parser in order to do new analysis
 		static void restartParser(void);
 
+		/*! \brief Compiles in parallel all the schema files (XML schemas and SQL schemas of all PostgreSQL versions)
+		 storing them on the compiled schemas cache. This method should be called at software startup so the
+		 code generation doesn't need to read and parse the schema files */
+		static void precompileSchemas(void);
+
 		//! \brief Set if the parser must ignore unknown attributes avoiding expcetion throwing
 		static void setIgnoreUnkownAttributes(bool ignore);
 };
@@ -1,13 +1,8 @@
 #include "xmlparser.h"
 
-QString XMLParser::xml_doc_filename="";
-QString XMLParser::xml_buffer="";
-QString XMLParser::dtd_decl="";
-QString XMLParser::xml_decl="";
-xmlNode *XMLParser::root_elem=NULL;
-xmlNode *XMLParser::curr_elem=NULL;
-xmlDoc *XMLParser::xml_doc=NULL;
-stack<xmlNode*> XMLParser::elems_stack;
+map<QString, xmlDtd *> XMLParser::dtd_cache;
+QMutex XMLParser::dtd_cache_mutex;
+map<xmlDtd *, QMutex *> XMLParser::dtd_locks;
 
 const QString XMLParser::CHAR_AMP="&amp;";
 const QString XMLParser::CHAR_LT="&lt;";
@@ -15,63 +10,65 @@ const QString XMLParser::CHAR_GT="&gt;";
 const QString XMLParser::CHAR_QUOT="&quot;";
 const QString XMLParser::CHAR_APOS="&apos;";
 
-XMLParser::~XMLParser(void)
+XMLParser::XMLParser(void)
 {
-	restartParser();
+	/* Initializes the libxml2 global state (only the first call has effect). This must be done before
+		 the parsers are used by different threads */
+	xmlInitParser();
+
+	root_elem=curr_elem=NULL;
+	xml_doc=NULL;
+	trust_checksum=false;
+	xml_reader=NULL;
+	reader_dtd=NULL;
+	reader_validate=false;
+	reader_file_size=0;
 }
 
-void XMLParser::removeDTD(void)
+XMLParser::~XMLParser(void)
 {
-	int pos1=-1, pos2=-1, pos3=-1, len;
-
-	if(!xml_buffer.isEmpty())
-	{
-		/* Removes the current DTD from document.
-		 If the user attempts to manipulate the structure of
-		 document damaging its integrity. */
-		pos1=xml_buffer.find("<!DOCTYPE");
-		pos2=xml_buffer.find("]>\n");
-		pos3=xml_buffer.find("\">\n");
-		if(pos1 >=0 && (pos2 >=0 || pos3 >= 0))
-		{
-			len=((pos2 > pos3) ? (pos2-pos1)+3 :  (pos3-pos2)+3);
-			xml_buffer.replace(pos1,len,"");
-		}
-	}
+	closeXMLStream();
+	restartParser();
 }
 
 void XMLParser::loadXMLFile(const QString &filename)
 {
 	try
 	{
-		ifstream input;
-		QString buffer, str_aux;
-		string line;
+		QFile input;
+		QString str_aux;
+		uchar *data=NULL;
 
 		if(filename!="")
 		{
-			//Opens a file stream using the file name
-			input.open(filename.toAscii(),ios_base::in);
+			input.setFileName(filename);
 
 			//Case the file opening was sucessful
-			if(!input.is_open())
+			if(!input.open(QFile::ReadOnly))
 			{
 				str_aux=QString(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED)).arg(filename);
 				throw Exception(str_aux,ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 			}
 
-			buffer="";
+			if(input.size()==0)
+				throw Exception(ERR_ASG_EMPTY_XML_BUFFER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			/* Maps the whole file on memory. In case of errors the file is unmapped and
+				 closed when the 'input' is destroyed */
+			data=input.map(0, input.size());
 
-			//Read the file line by line and store them on the parser buffer
-			while(!input.eof())
+			if(!data)
 			{
-				getline(input, line);
-				buffer+=QString::fromStdString(line) + "\n";
+				str_aux=QString(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED)).arg(filename);
+				throw Exception(str_aux,ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 			}
-			input.close();
 
 			xml_doc_filename=filename;
-			loadXMLBuffer(buffer);
+			xml_buffer="";
+			parseMemory(reinterpret_cast<const char *>(data), input.size());
+
+			input.unmap(data);
+			input.close();
 		}
 	}
 	catch(Exception &e)
@@ -84,33 +81,349 @@ void XMLParser::loadXMLBuffer(const QString &xml_buf)
 {
 	try
 	{
-		int pos1=-1, pos2=-1, tam=0;
-
 		if(xml_buf.isEmpty())
 			throw Exception(ERR_ASG_EMPTY_XML_BUFFER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		pos1=xml_buf.find("<?xml");
-		pos2=xml_buf.find("?>");
 		xml_buffer=xml_buf;
+		readBuffer();
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
 
-		if(pos1 >= 0 && pos2 >= 0)
+void XMLParser::openXMLStream(const QString &filename)
+{
+	try
+	{
+		QString str_aux, root_name;
+		int ret;
+
+		closeXMLStream();
+
+		if(filename!="")
 		{
-			tam=(pos2-pos1)+3;
-			xml_decl=xml_buffer.mid(pos1, tam);
-			xml_buffer.replace(pos1,tam,"");
-		}
-		else
-			xml_decl="<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+			if(!QFile::exists(filename))
+			{
+				str_aux=QString(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED)).arg(filename);
+				throw Exception(str_aux,ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
 
-		removeDTD();
-		readBuffer();
+			reader_file_size=QFile(filename).size();
+
+			if(reader_file_size==0)
+				throw Exception(ERR_ASG_EMPTY_XML_BUFFER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			/* The external DTD declared by the document (if any) is not loaded (XML_PARSE_DTDLOAD isn't used),
+				 the entities aren't substituted (XML_PARSE_NOENT isn't used) and the network access is disabled,
+				 so the elements are validated only against the DTD configured by setDTDFile() */
+			xml_reader=xmlReaderForFile(filename.toStdString().c_str(), NULL,
+																	XML_PARSE_NOBLANKS | XML_PARSE_NONET);
+
+			if(!xml_reader)
+			{
+				raiseParserError();
+				str_aux=QString(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED)).arg(filename);
+				throw Exception(str_aux,ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
+
+			//Moves the reader to the root element
+			do
+			{
+				ret=xmlTextReaderRead(xml_reader);
+			}
+			while(ret==1 && xmlTextReaderNodeType(xml_reader)!=XML_READER_TYPE_ELEMENT);
+
+			if(ret!=1)
+			{
+				raiseParserError();
+				throw Exception(ERR_ASG_EMPTY_XML_BUFFER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
+
+			/* Documents declaring an internal DTD subset are rejected since its entities could include the contents
+				 of external files into the elements. This way the stream accepts the same documents as parseMemory() */
+			if(xmlTextReaderCurrentDoc(xml_reader) && xmlTextReaderCurrentDoc(xml_reader)->intSubset)
+			{
+				throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
+												.arg(xmlTextReaderGetParserLineNumber(xml_reader)).arg(0)
+												.arg(QString("Not valid: internal DTD subset is not allowed"))
+												.arg(filename),
+												ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
+
+			root_elem=curr_elem=xmlTextReaderCurrentNode(xml_reader);
+			reader_filename=xml_doc_filename=filename;
+
+			if(!dtd_file.isEmpty())
+			{
+				//The root element must have the same name as the dtd
+				root_name=QString(reinterpret_cast<const char *>(root_elem->name));
+
+				if(root_name!=dtd_name)
+				{
+					throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
+													.arg(root_elem->line).arg(0)
+													.arg(QString("Not valid: root and DTD name do not match '%1' and '%2'").arg(root_name).arg(dtd_name))
+													.arg(""),
+													ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				}
+
+				//Trusted files are read without validation but still have the default attributes filled by the DTD
+				reader_dtd=getDTD(dtd_file);
+				reader_validate=(!trust_checksum || !isChecksumValid(filename));
+				raiseParserError();
+			}
+		}
 	}
 	catch(Exception &e)
 	{
+		closeXMLStream();
 		throw Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
 }
 
+bool XMLParser::readNextStreamElement(void)
+{
+	xmlNode *node=NULL;
+	xmlValidCtxt *valid_ctx=NULL;
+	bool found=false;
+	int ret, depth;
+
+	if(!xml_reader)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	/* When the reader is positioned on an element already read (child of the root) its subtree is skipped,
+		 otherwise the reader is at the start of the root element and the next node is read */
+	if(xmlTextReaderDepth(xml_reader) > 0)
+		ret=xmlTextReaderNext(xml_reader);
+	else
+		ret=xmlTextReaderRead(xml_reader);
+
+	while(ret==1 && !found)
+	{
+		depth=xmlTextReaderDepth(xml_reader);
+		found=(depth==1 && xmlTextReaderNodeType(xml_reader)==XML_READER_TYPE_ELEMENT);
+
+		//Reaching a node of depth 0 indicates the end of the root element
+		if(depth==0)
+			ret=0;
+		else if(!found)
+			ret=xmlTextReaderNext(xml_reader);
+	}
+
+	if(ret < 0)
+		raiseParserError();
+
+	if(!found)
+		return(false);
+
+	//Builds the element tree of the current element
+	node=xmlTextReaderExpand(xml_reader);
+
+	if(!node)
+		raiseParserError();
+
+	if(reader_dtd)
+	{
+		QMutexLocker locker(getDTDLock(reader_dtd));
+
+		/* The element is validated assigning the DTD temporarily as the external subset
+			 of the document being built by the reader */
+		if(reader_validate)
+		{
+			node->doc->extSubset=reader_dtd;
+			valid_ctx=xmlNewValidCtxt();
+			xmlValidateElement(valid_ctx, node->doc, node);
+			xmlFreeValidCtxt(valid_ctx);
+			node->doc->extSubset=NULL;
+		}
+
+		applyDTDDefaults(reader_dtd, node);
+		locker.unlock();
+
+		raiseParserError();
+	}
+
+	accessStreamElement();
+	return(true);
+}
+
+void XMLParser::accessStreamElement(void)
+{
+	if(!xml_reader)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	//Deallocates the document loaded while the stream was open (if any)
+	restartParser();
+
+	xml_doc_filename=reader_filename;
+	root_elem=curr_elem=xmlTextReaderCurrentNode(xml_reader);
+}
+
+void XMLParser::closeXMLStream(void)
+{
+	if(xml_reader)
+	{
+		//The navigation is reset when it is over an element of the stream since it will be deallocated
+		if(!xml_doc)
+		{
+			root_elem=curr_elem=NULL;
+
+			while(!elems_stack.empty())
+				elems_stack.pop();
+		}
+
+		xmlFreeTextReader(xml_reader);
+		xml_reader=NULL;
+	}
+
+	//The DTD is not deallocated since it belongs to the DTD cache
+	reader_dtd=NULL;
+	reader_validate=false;
+	reader_filename="";
+	reader_file_size=0;
+}
+
+int XMLParser::getStreamProgress(void)
+{
+	if(!xml_reader || reader_file_size==0)
+		return(0);
+	else
+		return(qMin<qint64>(100, (xmlTextReaderByteConsumed(xml_reader) * 100)/reader_file_size));
+}
+
+xmlDtd *XMLParser::getDTD(const QString &dtd_file)
+{
+	QMutexLocker locker(&dtd_cache_mutex);
+	xmlDtd *dtd=NULL;
+
+	if(dtd_cache.count(dtd_file)==0)
+	{
+		dtd=xmlParseDTD(NULL, reinterpret_cast<const xmlChar *>(dtd_file.toStdString().c_str()));
+
+		//Only the successfully parsed DTDs are cached so the errors are raised every time the file is used
+		if(dtd)
+		{
+			dtd_cache[dtd_file]=dtd;
+			dtd_locks[dtd]=new QMutex;
+		}
+	}
+	else
+		dtd=dtd_cache[dtd_file];
+
+	return(dtd);
+}
+
+QMutex *XMLParser::getDTDLock(xmlDtd *dtd)
+{
+	QMutexLocker locker(&dtd_cache_mutex);
+	return(dtd_locks[dtd]);
+}
+
+void XMLParser::applyDTDDefaults(xmlDtd *dtd, xmlNode *elem)
+{
+	xmlElement *elem_decl=NULL;
+	xmlAttribute *attr_decl=NULL;
+	xmlNode *child=NULL;
+
+	if(elem && elem->type==XML_ELEMENT_NODE)
+	{
+		elem_decl=xmlGetDtdElementDesc(dtd, elem->name);
+
+		if(elem_decl)
+			attr_decl=elem_decl->attributes;
+
+		//Only the attributes declared with a default value (optional or fixed) are filled
+		while(attr_decl)
+		{
+			if(attr_decl->defaultValue && !xmlHasProp(elem, attr_decl->name) &&
+				 (attr_decl->def==XML_ATTRIBUTE_NONE || attr_decl->def==XML_ATTRIBUTE_FIXED))
+				xmlSetProp(elem, attr_decl->name, attr_decl->defaultValue);
+
+			attr_decl=attr_decl->nexth;
+		}
+
+		child=elem->children;
+		while(child)
+		{
+			applyDTDDefaults(dtd, child);
+			child=child->next;
+		}
+	}
+}
+
+void XMLParser::clearDTDCache(void)
+{
+	QMutexLocker locker(&dtd_cache_mutex);
+	map<QString, xmlDtd *>::iterator itr=dtd_cache.begin();
+
+	while(itr!=dtd_cache.end())
+	{
+		delete(dtd_locks[itr->second]);
+		xmlFreeDtd(itr->second);
+		itr++;
+	}
+
+	dtd_cache.clear();
+	dtd_locks.clear();
+}
+
+bool XMLParser::isChecksumValid(const char *data, qint64 size)
+{
+	const QByteArray chksum_tag="<!-- checksum: ", chksum_end=" -->";
+	QByteArray header=QByteArray::fromRawData(data, qMin<qint64>(size, 1024)), checksum;
+	int pos, hash_pos;
+
+	pos=header.indexOf(chksum_tag);
+
+	if(pos < 0)
+		return(false);
+
+	pos+=chksum_tag.size();
+	hash_pos=header.indexOf(chksum_end, pos);
+
+	if(hash_pos < 0)
+		return(false);
+
+	checksum=header.mid(pos, hash_pos - pos);
+
+	//The hash covers all the contents after the line of the checksum comment
+	hash_pos=header.indexOf('\n', hash_pos);
+
+	if(hash_pos < 0)
+		return(false);
+
+	hash_pos++;
+	return(QCryptographicHash::hash(QByteArray::fromRawData(data + hash_pos, size - hash_pos),
+																	QCryptographicHash::Sha1).toHex()==checksum);
+}
+
+bool XMLParser::isChecksumValid(const QString &filename)
+{
+	QFile input(filename);
+	uchar *data=NULL;
+	bool valid=false;
+
+	if(input.open(QFile::ReadOnly) && input.size() > 0)
+	{
+		data=input.map(0, input.size());
+
+		if(data)
+		{
+			valid=isChecksumValid(reinterpret_cast<const char *>(data), input.size());
+			input.unmap(data);
+		}
+	}
+
+	return(valid);
+}
+
+void XMLParser::setTrustChecksum(bool trust)
+{
+	trust_checksum=trust;
+}
+
 void XMLParser::setDTDFile(const QString &dtd_file, const QString &dtd_name)
 {
 	if(dtd_file.isEmpty())
@@ -119,65 +432,117 @@ void XMLParser::setDTDFile(const QString &dtd_file, const QString &dtd_name)
 	if(dtd_name.isEmpty())
 		throw Exception(ERR_ASG_EMPTY_DTD_NAME,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	dtd_decl="<!DOCTYPE " + dtd_name + " SYSTEM " + "\"" +  dtd_file + "\">\n";
+	this->dtd_file=dtd_file;
+	this->dtd_name=dtd_name;
 }
 
 void XMLParser::readBuffer(void)
 {
-	QString buffer, msg, file;
-	xmlError *xml_error=NULL;
+	if(!xml_buffer.isEmpty())
+		parseMemory(xml_buffer.toStdString().c_str(), xml_buffer.size());
+}
+
+void XMLParser::parseMemory(const char *data, int size)
+{
+	xmlParserCtxt *parser_ctx=NULL;
+	xmlValidCtxt *valid_ctx=NULL;
+	xmlDtd *dtd=NULL;
+	QString root_name;
 	int parser_opt;
 
-	if(!xml_buffer.isEmpty())
-	{
-		//Inserts the XML declaration
-		buffer+=xml_decl;
+	parser_ctx=xmlNewParserCtxt();
 
-		//Configures the parser, initially, to not validate the document against the dtd
-		parser_opt=( XML_PARSE_NOBLANKS | XML_PARSE_NONET | XML_PARSE_NOENT );
+	if(!parser_ctx)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		//If the dtd declarions is setup
-		if(!dtd_decl.isEmpty())
-		{
-			//Inserts the default software DTD declarion into XML buffer
-			buffer+=dtd_decl;
+	/* Disables the handlers of DTD declarations on the parser context, this way the DOCTYPE
+		 of the document (if any) is ignored, as well as the entities declared by it, and no external
+		 DTD is loaded during the parsing */
+	parser_ctx->sax->internalSubset=NULL;
+	parser_ctx->sax->externalSubset=NULL;
+	parser_ctx->sax->entityDecl=NULL;
+	parser_ctx->sax->unparsedEntityDecl=NULL;
+	parser_ctx->sax->notationDecl=NULL;
+	parser_ctx->sax->elementDecl=NULL;
+	parser_ctx->sax->attributeDecl=NULL;
 
-			//Now configures the parser to validate the buffer against the DTD
-			parser_opt=(parser_opt | XML_PARSE_DTDLOAD | XML_PARSE_DTDVALID);
-		}
+	parser_opt=( XML_PARSE_NOBLANKS | XML_PARSE_NONET | XML_PARSE_NOENT );
 
-		buffer+=xml_buffer;
+	//Create an xml document from the memory block
+	xml_doc=xmlCtxtReadMemory(parser_ctx, data, size, NULL, NULL, parser_opt);
+	xmlFreeParserCtxt(parser_ctx);
 
-		//Create an xml document from the buffer
-		xml_doc=xmlReadMemory(buffer.toStdString().c_str(), buffer.size(),
-													NULL, NULL, parser_opt);
+	//In case the document criation fails raises the last xml parser error
+	raiseParserError();
 
-		//In case the document criation fails, gets the last xml parser error
-		xml_error=xmlGetLastError();
+	/* If the dtd is configured validates the document against it (trusted documents aren't validated)
+		 and fills the attributes omitted by the document with their default values */
+	if(!dtd_file.isEmpty())
+	{
+		dtd=getDTD(dtd_file);
 
-		//If some error is set
-		if(xml_error)
+		if(dtd)
 		{
-			//Formats the error
-			msg=xml_error->message;
-			file=xml_error->file;
-			if(!file.isEmpty()) file="("+file+")";
-			msg.replace("\n"," ");
+			//The cached DTD is shared with the other parsers so the validation is serialized
+			QMutexLocker locker(getDTDLock(dtd));
 
-			//Restarts the parser
-			if(xml_doc) restartParser();
+			if(!trust_checksum || !isChecksumValid(data, size))
+			{
+				valid_ctx=xmlNewValidCtxt();
+				xmlValidateDtd(valid_ctx, xml_doc, dtd);
+				xmlFreeValidCtxt(valid_ctx);
+			}
 
-			//Raise an exception with the error massege from the parser xml
+			applyDTDDefaults(dtd, xmlDocGetRootElement(xml_doc));
+		}
+
+		raiseParserError();
+
+		//The root element must have the same name as the dtd
+		root_name=QString(reinterpret_cast<const char *>(xmlDocGetRootElement(xml_doc)->name));
+
+		if(root_name!=dtd_name)
+		{
+			int line=xmlDocGetRootElement(xml_doc)->line;
+
+			restartParser();
 			throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
-											.arg(xml_error->line).arg(xml_error->int2).arg(msg).arg(file),
+											.arg(line).arg(0)
+											.arg(QString("Not valid: root and DTD name do not match '%1' and '%2'").arg(root_name).arg(dtd_name))
+											.arg(""),
 											ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
+	}
+
+	//Gets the referênce to the root element on the document
+	root_elem=curr_elem=xmlDocGetRootElement(xml_doc);
+}
 
-		//Gets the referênce to the root element on the document
-		root_elem=curr_elem=xmlDocGetRootElement(xml_doc);
+void XMLParser::raiseParserError(void)
+{
+	xmlError *xml_error=xmlGetLastError();
 
-		//Cleanup the allocated parser variables
-		if(xml_doc) xmlCleanupParser();
+	//If some error is set
+	if(xml_error)
+	{
+		QString msg, file;
+		int line, column;
+
+		//Formats the error
+		msg=xml_error->message;
+		file=xml_error->file;
+		line=xml_error->line;
+		column=xml_error->int2;
+		if(!file.isEmpty()) file="("+file+")";
+		msg.replace("\n"," ");
+
+		//Restarts the parser
+		if(xml_doc) restartParser();
+
+		//Raise an exception with the error massege from the parser xml
+		throw Exception(QString(Exception::getErrorMessage(ERR_LIBXMLERR))
+										.arg(line).arg(column).arg(msg).arg(file),
+										ERR_LIBXMLERR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -207,7 +572,7 @@ void XMLParser::restorePosition(const xmlNode *elem)
 {
 	if(!elem)
 		throw Exception(ERR_OPR_NOT_ALOC_ELEMENT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-	else if(elem->doc!=xml_doc)
+	else if(!root_elem || elem->doc!=root_elem->doc)
 		throw Exception(ERR_OPR_INEXIST_ELEMENT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	restartNavigation();
@@ -233,7 +598,8 @@ void XMLParser::restartParser(void)
 		xmlFreeDoc(xml_doc);
 		xml_doc=NULL;
 	}
-	dtd_decl=xml_buffer=xml_decl="";
+	dtd_file=dtd_name=xml_buffer="";
+	trust_checksum=false;
 
 	while(!elems_stack.empty())
 		elems_stack.pop();
@@ -362,7 +728,35 @@ QString XMLParser::getLoadedFilename(void)
 
 QString XMLParser::getXMLBuffer(void)
 {
-	return(xml_buffer);
+	//Documents loaded from files don't use the buffer, so the file contents are read
+	if(xml_buffer.isEmpty() && !xml_doc_filename.isEmpty())
+	{
+		QFile input(xml_doc_filename);
+
+		if(!input.open(QFile::ReadOnly))
+			throw Exception(QString(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED)).arg(xml_doc_filename),
+											ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		return(QString(input.readAll()));
+	}
+	else
+		return(xml_buffer);
+}
+
+QString XMLParser::getCurrentElementXML(void)
+{
+	xmlBuffer *buffer=NULL;
+	QString xml_def;
+
+	if(!root_elem)
+		throw Exception(ERR_OPR_NOT_ALOC_ELEM_TREE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	buffer=xmlBufferCreate();
+	xmlNodeDump(buffer, curr_elem->doc, curr_elem, 0, 0);
+	xml_def=QString(reinterpret_cast<const char *>(xmlBufferContent(buffer)));
+	xmlBufferFree(buffer);
+
+	return(xml_def);
 }
 
 int XMLParser::getCurrentBufferLine(void)
@@ -19,7 +19,9 @@
 /**
 \ingroup libparsers
 \class XMLParser
-\brief This class implements basic operations of a xml analyzer encapsulating some functions implemented by libxml2 library
+\brief This class implements basic operations of a xml analyzer encapsulating some functions implemented by libxml2 library.
+ Each instance has its own document and navigation state so different documents can be analyzed at the same time
+ (e.g. each database model uses its own parser, which permits models to be loaded in different threads)
 \note <strong>Creation date:</strong> 02/04/2008
 */
 
@@ -28,6 +30,11 @@
 
 #include <libxml/parser.h>
 #include <libxml/tree.h>
+#include <libxml/valid.h>
+#include <libxml/xmlreader.h>
+#include <QFile>
+#include <QMutex>
+#include <QCryptographicHash>
 #include "schemaparser.h"
 #include "exception.h"
 #include <fstream>
@@ -40,39 +47,98 @@ class XMLParser {
 	private:
 		/*! \brief Stores the name of the file that generated the xml buffer when
 		 loadXMLFile() method is called */
-		static QString xml_doc_filename;
+		QString xml_doc_filename;
 
 		//! \brief Stores the xml document (element tree) generated after the buffer reading
-		static xmlDoc *xml_doc;
+		xmlDoc *xml_doc;
 
 		//! \brief Stores the reference to the root element of the element tree
-		static xmlNode	*root_elem,
-										//! \brief Stores the current element that parser is analyzing
-										*curr_elem;
+		xmlNode	*root_elem,
+						//! \brief Stores the current element that parser is analyzing
+						*curr_elem;
 
 		/*! \brief Stores the elements that marks the position in the tree before do
 		 a subsequent operation. To configure this element it is necessary
 		 call the method savePosition() and to return the navigation to the saved
 		 position is necessary call restorePosition() */
-		static stack<xmlNode *> elems_stack;
+		stack<xmlNode *> elems_stack;
 
-		//! \brief Stores the document DTD declaration
-		static QString	dtd_decl,
-										//! \brief Stores XML document to be analyzed
-										xml_buffer,
-										/*! \brief Stores the declaration <?xml?>. If this isn't exists it will be
-										 a default declaration. */
-										xml_decl;
+		//! \brief Stores the path to the DTD file used to validate the document
+		QString	dtd_file,
+						//! \brief Stores the name of the DTD (which must be the name of the root element)
+						dtd_name,
+						/*! \brief Stores XML document to be analyzed when it is loaded by loadXMLBuffer().
+						 Documents loaded from files are not stored on this buffer */
+						xml_buffer;
 
-		/*! \brief Remove the original DTD from the document. This is done to evit that
-		 the user insert some external dtd in the model file that is not valid for pgModeler */
-		static void removeDTD(void);
+		/*! \brief Indicates that documents having a valid checksum on their header (see isChecksumValid())
+		 must not be validated against the DTD */
+		bool trust_checksum;
+
+		//! \brief Stores the DTDs already parsed (the key is the path to the DTD file)
+		static map<QString, xmlDtd *> dtd_cache;
+
+		//! \brief Mutex that protects the DTD cache which is shared between all parser instances
+		static QMutex dtd_cache_mutex;
+
+		/*! \brief Mutexes that serialize the validations made against each cached DTD. libxml2 builds the
+		 content models (automata) of the DTD elements on the first validations so a DTD can't be used
+		 by two validations at the same time */
+		static map<xmlDtd *, QMutex *> dtd_locks;
+
+		/*! \brief Returns the parsed DTD stored on the passed file. The file is parsed only on the first
+		 call, the subsequent ones return the cached DTD. Returns NULL when the DTD can't be parsed */
+		static xmlDtd *getDTD(const QString &dtd_file);
+
+		//! \brief Returns the mutex that must be locked while validating against the passed cached DTD
+		static QMutex *getDTDLock(xmlDtd *dtd);
+
+		/*! \brief Fills the attributes omitted on the passed element and its children with the default values
+		 declared by the DTD. Since the DTD is not loaded by the parser contexts (see parseMemory()) the defaults aren't
+		 applied while parsing and the validation against the DTD doesn't apply them either. The lock of the DTD
+		 (see getDTDLock()) must be held by the caller */
+		static void applyDTDDefaults(xmlDtd *dtd, xmlNode *elem);
+
+		/*! \brief Returns whether the passed document has a valid checksum. The checksum is a comment
+		 in the form <!-- checksum: [SHA-1 HEX] --> placed on the header of the document (first 1024 bytes) whose
+		 value is the SHA-1 hash of all the contents after the line of the comment. The documents written by
+		 pgModeler carry this comment (see DatabaseModel::writeCodeDefinition()) */
+		static bool isChecksumValid(const char *data, qint64 size);
+
+		//! \brief Returns whether the passed file has a valid checksum (see isChecksumValid(const char *, qint64))
+		static bool isChecksumValid(const QString &filename);
+
+		//! \brief Pull parser used to read a document element by element (see openXMLStream())
+		xmlTextReader *xml_reader;
+
+		//! \brief DTD used to validate and to fill the default attributes of the elements read from the stream
+		xmlDtd *reader_dtd;
+
+		//! \brief Indicates that the elements read from the stream must be validated against reader_dtd
+		bool reader_validate;
+
+		//! \brief Name and size of the file being read by the stream
+		QString reader_filename;
+		qint64 reader_file_size;
+
+		//! \brief The parser can't be copied since it owns the element tree and the pull parser
+		XMLParser(const XMLParser &);
+		XMLParser &operator = (const XMLParser &);
+
+		/*! \brief Makes the interpretation of the XML contained by the passed memory block. Any DTD declared by
+		 the document is ignored by the parser context (this is done to evit that the user insert some external dtd in
+		 the model file that is not valid for pgModeler). The generated document is then validated against the DTD
+		 configured by setDTDFile(). Initializes the necessary attributes to make possible the navigation
+		 through the element tree generated from the XML document read. */
+		void parseMemory(const char *data, int size);
 
 		/*! \brief Makes the interpretation of XML inside the buffer validating it according to
-		 DTD defined configured (by the parser) to the buffer. Initializes
-		 the necessary attributes to make possible the navigation through the element tree
-		 generated from the XML document read. */
-		static void readBuffer(void);
+		 DTD defined configured (by the parser) to the buffer. */
+		void readBuffer(void);
+
+		/*! \brief Raises an exception containing the last error generated by libxml2 (if any).
+		 The element tree is deallocated in case of error */
+		void raiseParserError(void);
 
 	public:
 		//! \brief Constants used to referência the elements on the element tree
@@ -90,71 +156,108 @@ class XMLParser {
 		XMLParser(void);
 		~XMLParser(void);
 
-		//! \brief Loads the XML buffer from a file
-		static void loadXMLFile(const QString &filename);
+		/*! \brief Loads the XML document from a file. The file is mapped on memory and its
+		 contents are passed directly to libxml2 without intermediate copies */
+		void loadXMLFile(const QString &filename);
 
 		//! \brief Loads the XML buffer from a string
-		static void loadXMLBuffer(const QString &xml_buf);
+		void loadXMLBuffer(const QString &xml_buf);
+
+		/*! \brief Opens the file to be read element by element (streaming mode) instead of building the
+		 whole element tree at once. After this method the parser is positioned at the root element (only its
+		 attributes are available) and each child element of the root must be obtained by calling
+		 readNextStreamElement(). The DTD configured by setDTDFile() is used to validate the elements as they
+		 are read. The stream remains open until closeXMLStream() is called, even if other buffers are
+		 loaded meanwhile (restartParser() doesn't affect the stream) */
+		void openXMLStream(const QString &filename);
+
+		/*! \brief Reads the next child element of the stream root, with all its subelements, and moves
+		 the navigation to it. The element read previously is deallocated. Returns false when there are no
+		 more elements to be read */
+		bool readNextStreamElement(void);
+
+		/*! \brief Moves the navigation back to the last element read from the stream. This must be called
+		 after loading other buffers while the stream is open */
+		void accessStreamElement(void);
+
+		//! \brief Closes the stream deallocating the pull parser
+		void closeXMLStream(void);
+
+		//! \brief Returns the percentage of the stream file already read
+		int getStreamProgress(void);
+
+		/*! \brief Configures the parser to skip the DTD validation of the next document loaded when it has a
+		 valid checksum, which means that it was written by pgModeler and not modified since then. This setting
+		 is reset by restartParser() */
+		void setTrustChecksum(bool trust);
+
+		/*! \brief Deallocates the cached DTDs forcing the files to be parsed again. This must be called
+		 when the DTD files are changed on disk and while no document is being loaded */
+		static void clearDTDCache(void);
 
 		//! \brief Informs the DTD file used to make element validations
-		static void setDTDFile(const QString &dtd_file, const QString &dtd_name);
+		void setDTDFile(const QString &dtd_file, const QString &dtd_name);
 
 		//! \brief Saves to stack the current navigation position on the element tree
-		static void savePosition(void);
+		void savePosition(void);
 
 		//! \brief Restores the previous navigation position oh the element tree
-		static void restorePosition(void);
+		void restorePosition(void);
 
 		/*! \brief Restores the position of the navigation on a specific
 		 element on the document. The navigation stack is always
 		 emptied when this method is called */
-		static void restorePosition(const xmlNode *elem);
+		void restorePosition(const xmlNode *elem);
 
 		/*! \brief Moves one level in the element tree according to the type of element
 		 to be accessed. Returns true if the position was moved to the
 		 desired element. */
-		static bool accessElement(unsigned elem_type);
+		bool accessElement(unsigned elem_type);
 
 		//! \brief Returns if an element has a root, child, previous or next element
-		static bool hasElement(unsigned elem_type);
+		bool hasElement(unsigned elem_type);
 
 		//! \brief Retorns if an element has attributes
-		static bool hasAttributes(void);
+		bool hasAttributes(void);
 
 		//! \brief Stores on a map the atrributes (names and values) of the current element
-		static void getElementAttributes(map<QString, QString> &attributes);
+		void getElementAttributes(map<QString, QString> &attributes);
 
 		/*! \brief Returns the content text of the element, used only for elements which do not have children
 		 and that are filled by simple texts */
-		static QString getElementContent(void);
+		QString getElementContent(void);
 
 		//! \brief Returns the current element type
-		static xmlElementType getElementType(void);
+		xmlElementType getElementType(void);
 
 		//! \brief Returns the constant reference to the current element on the tree
-		static const xmlNode *getCurrentElement(void);
+		const xmlNode *getCurrentElement(void);
+
+		//! \brief Returns the XML code of the current element (including its children)
+		QString getCurrentElementXML(void);
 
 		//! \brief Returns the current line number on the buffer that is being processed
-		static int getCurrentBufferLine(void);
+		int getCurrentBufferLine(void);
 
 		//! \brief Returns the total line amount of the buffer
-		static int getBufferLineCount(void);
+		int getBufferLineCount(void);
 
 		//! \brief Returns the tag name that defines the current element
-		static QString getElementName(void);
+		QString getElementName(void);
 
 		//! \brief Returns the filename that generated XML buffer
-		static QString getLoadedFilename(void);
+		QString getLoadedFilename(void);
 
-		//! \brief Returns the full parser buffer
-		static QString getXMLBuffer(void);
+		/*! \brief Returns the full parser buffer. If the document was loaded from a file
+		 its contents are read and returned */
+		QString getXMLBuffer(void);
 
 		//! \brief Reset all the elements resposible to the navigation through the element tree
-		static void restartNavigation(void);
+		void restartNavigation(void);
 
 		/*! \brief Reset all the parser attributes, deallocating the element tree. The user have to
 		 reload the file to analyze it again */
-		static void restartParser(void);
+		void restartParser(void);
 };
 
 #endif
@@ -28,6 +28,8 @@ void Aggregate::setFunction(unsigned func_idx, Function *func)
 										ERR_USING_INV_FUNC_CONFIG,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	functions[func_idx]=func;
+
+	setReferencesModified();
 }
 
 bool Aggregate::isValidFunction(unsigned func_idx, Function *func)
@@ -67,11 +69,13 @@ bool Aggregate::isValidFunction(unsigned func_idx, Function *func)
 void Aggregate::setStateType(PgSQLType state_type)
 {
 	this->state_type=state_type;
+	setCodeInvalidated();
 }
 
 void Aggregate::setInitialCondition(const QString &cond)
 {
 	initial_condition=cond;
+	setCodeInvalidated();
 }
 
 void Aggregate::setSortOperator(Operator *sort_op)
@@ -97,6 +101,8 @@ void Aggregate::setSortOperator(Operator *sort_op)
 	}
 
 	this->sort_operator=sort_op;
+
+	setReferencesModified();
 }
 
 void Aggregate::setTypesAttribute(unsigned def_type)
@@ -132,6 +138,8 @@ void Aggregate::addDataType(PgSQLType type)
 										ERR_INS_DUPLIC_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	data_types.push_back(type);
+
+	setReferencesModified();
 }
 
 void Aggregate::removeDataType(unsigned type_idx)
@@ -142,11 +150,15 @@ void Aggregate::removeDataType(unsigned type_idx)
 
 	//Removes the type at the specified position
 	data_types.erase(data_types.begin() + type_idx);
+
+	setReferencesModified();
 }
 
 void Aggregate::removeDataTypes(void)
 {
 	data_types.clear();
+
+	setReferencesModified();
 }
 
 bool Aggregate::isDataTypeExist(PgSQLType type)
@@ -214,9 +226,8 @@ QString Aggregate::getCodeDefinition(unsigned def_type)
 			attributes[ParsersAttributes::TRANSITION_FUNC]=functions[TRANSITION_FUNC]->getSignature();
 		else
 		{
-			functions[TRANSITION_FUNC]->setAttribute(ParsersAttributes::REF_TYPE,
-																							 ParsersAttributes::TRANSITION_FUNC);
-			attributes[ParsersAttributes::TRANSITION_FUNC]=functions[TRANSITION_FUNC]->getCodeDefinition(def_type,true);
+			attributes[ParsersAttributes::TRANSITION_FUNC]=getReferenceCodeDefinition(functions[TRANSITION_FUNC], def_type,
+																																								 ParsersAttributes::TRANSITION_FUNC);
 		}
 	}
 
@@ -226,9 +237,8 @@ QString Aggregate::getCodeDefinition(unsigned def_type)
 			attributes[ParsersAttributes::FINAL_FUNC]=functions[FINAL_FUNC]->getSignature();
 		else
 		{
-			functions[FINAL_FUNC]->setAttribute(ParsersAttributes::REF_TYPE,
-																					ParsersAttributes::FINAL_FUNC);
-			attributes[ParsersAttributes::FINAL_FUNC]=functions[FINAL_FUNC]->getCodeDefinition(def_type,true);
+			attributes[ParsersAttributes::FINAL_FUNC]=getReferenceCodeDefinition(functions[FINAL_FUNC], def_type,
+																																					 ParsersAttributes::FINAL_FUNC);
 		}
 	}
 
@@ -237,7 +247,7 @@ QString Aggregate::getCodeDefinition(unsigned def_type)
 		if(def_type==SchemaParser::SQL_DEFINITION)
 			attributes[ParsersAttributes::SORT_OP]=sort_operator->getName(true);
 		else
-			attributes[ParsersAttributes::SORT_OP]=sort_operator->getCodeDefinition(def_type,true);
+			attributes[ParsersAttributes::SORT_OP]=getReferenceCodeDefinition(sort_operator, def_type);
 	}
 
 	if(initial_condition!="")
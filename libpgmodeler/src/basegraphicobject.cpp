@@ -12,6 +12,7 @@ BaseGraphicObject::BaseGraphicObject(void)
 void BaseGraphicObject::setProtected(bool value)
 {
 	is_protected=value;
+	setCodeInvalidated();
 
 	if(!this->signalsBlocked())
 		emit s_objectProtected(value);
@@ -21,6 +22,10 @@ void BaseGraphicObject::setModified(bool value)
 {
 	is_modified=value;
 
+	//A modified object has its code generated again
+	if(is_modified)
+		setCodeInvalidated();
+
 	if(!this->signalsBlocked() && is_modified)
 		emit s_objectModified();
 }
@@ -41,6 +46,7 @@ void BaseGraphicObject::setPositionAttribute(void)
 void  BaseGraphicObject::setPosition(QPointF pos)
 {
 	position=pos;
+	setCodeInvalidated();
 }
 
 QPointF BaseGraphicObject::getPosition(void)
@@ -52,6 +58,7 @@ void BaseGraphicObject::operator = (BaseGraphicObject &obj)
 {
 	*(dynamic_cast<BaseObject *>(this))=dynamic_cast<BaseObject &>(obj);
 	this->position=obj.position;
+	setCodeInvalidated();
 }
 
 void BaseGraphicObject::setReceiverObject(QObject *obj)
@@ -42,12 +42,17 @@ QString BaseObject::objs_sql[OBJECT_TYPE_COUNT]={
 	 starts at 60k because the id ranges 0, 10k, 20k, 30k, 40k and 50k
 	 are respectively assigned to objects of classes Role, Tablespace
 	 DBModel, Schema, Function and Type */
-unsigned BaseObject::global_id=60000;
+QAtomicInt BaseObject::global_id(60000);
+QThreadStorage<ObjectIdBlock *> BaseObject::id_blocks;
+QMutex BaseObject::ref_code_mutex(QMutex::Recursive);
 
 BaseObject::BaseObject(void)
 {
-	object_id=BaseObject::global_id++;
+	object_id=BaseObject::generateObjectId();
+
 	is_protected=false;
+	code_cached[0]=code_cached[1]=false;
+	name_changed[0]=name_changed[1]=false;
 	obj_type=BASE_OBJECT;
 	schema=NULL;
 	owner=NULL;
@@ -66,6 +71,65 @@ unsigned BaseObject::getGlobalId(void)
 	return(global_id);
 }
 
+unsigned BaseObject::reserveObjectIds(unsigned count)
+{
+	return(global_id.fetchAndAddOrdered(count));
+}
+
+void BaseObject::setReservedObjectIds(unsigned first_id, unsigned count)
+{
+	if(!id_blocks.hasLocalData())
+		id_blocks.setLocalData(new ObjectIdBlock);
+
+	if(count > 0)
+	{
+		id_blocks.localData()->next_id=first_id;
+		id_blocks.localData()->last_id=first_id + count - 1;
+	}
+	else
+	{
+		id_blocks.localData()->next_id=1;
+		id_blocks.localData()->last_id=0;
+	}
+
+	id_blocks.localData()->exhausted=false;
+}
+
+bool BaseObject::isReservedObjectIdsExhausted(void)
+{
+	return(id_blocks.hasLocalData() && id_blocks.localData()->exhausted);
+}
+
+unsigned BaseObject::generateObjectId(void)
+{
+	ObjectIdBlock *block=(id_blocks.hasLocalData() ? id_blocks.localData() : NULL);
+
+	if(block && block->next_id <= block->last_id)
+		return(block->next_id++);
+	else
+	{
+		if(block && block->last_id!=0)
+			block->exhausted=true;
+
+		return(global_id.fetchAndAddOrdered(1));
+	}
+}
+
+QString BaseObject::getReferenceCodeDefinition(BaseObject *object, unsigned def_type, const QString &ref_type)
+{
+	if(!object)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	/* The lock is recursive because a referenced object can reference others as well
+		 (e.g. the language of a function) */
+	QMutexLocker locker(&ref_code_mutex);
+
+	if(!ref_type.isEmpty())
+		object->attributes[ParsersAttributes::REF_TYPE]=ref_type;
+
+	return(object->getCodeDefinition(def_type, true));
+}
+
 QString BaseObject::getTypeName(ObjectType obj_type)
 {
 	if(obj_type!=BASE_OBJECT)
@@ -89,29 +153,30 @@ QString BaseObject::getSQLName(ObjectType obj_type)
 
 QString BaseObject::formatName(const QString &name, bool is_operator)
 {
-	int i;
-	bool is_formated=false;
+	int i, len;
+	bool is_formated=false, is_upper=false, is_ascii=true;
 	QString frmt_name;
 	QChar chr, chr1, chr2;
-	QRegExp regexp_vect[]={
-		QRegExp("(\")(.)+(\")"),
-		QRegExp("(\")(.)+(\")(\\.)(\")(.)+(\")"),
-		QRegExp("(\")(.)+(\")(\\.)(.)+"),
-		QRegExp("(.)+(\\.)(\")(.)+(\")"),
-		QRegExp("(.)+(\\.)(.)+")
-	};
-
-	/* Checks through regular expressions
-		if the name passed to be formatted is yet
-		formatted. The forms likely to be formatted are:
+
+	/* Checks if the name passed to be formatted is yet formatted.
+		The forms likely to be formatted are:
 
 		1) "OBJECT_NAME"
 		2) "SCHEMA_NAME"."OBJECT_NAME"
 		3) "SCHEMA_NAME".OBJECT_NAME
 		4) SCHEMA_NAME."OBJECT_NAME"
-		5) SCHEMA_NAME.OBJECT_NAME */
-	for(i=0; i < 5 && !is_formated; i++)
-		is_formated=regexp_vect[i].exactMatch(name);
+		5) SCHEMA_NAME.OBJECT_NAME
+
+		The forms 2, 3 and 4 are particular cases of the form 5 so the name
+		is formatted when it's enclosed in quotes (with at least one character between them)
+		or when it has a dot that is neither the first nor the last character. This check
+		is made by a simple scan instead of regular expressions since this method is called
+		several times for each object during the code generation */
+	len=name.size();
+	is_formated=(len >= 3 && name[0]=='"' && name[len-1]=='"');
+
+	for(i=1; i < len-1 && !is_formated; i++)
+		is_formated=(name[i]=='.');
 
 	/* If the name is not formatted or it symbolizes the name of an operator
 		(which has characters invalid according to the rule and is the only exception
@@ -119,51 +184,61 @@ QString BaseObject::formatName(const QString &name, bool is_operator)
 		 with PostgreSQL rules for other types of objects */
 	if(!is_formated && (is_operator || isValidName(name)))
 	{
-		bool is_upper=false;
-		unsigned i, qtd;
-
 		/* Checks if the name has some upper case letter. If its the
-		 case the name will be enclosed in quotes */
-		qtd=name.size();
-		i=0;
-		while(i < qtd && !is_upper)
+		 case the name will be enclosed in quotes. Names composed only by ASCII
+		 characters (the most common case) are checked directly */
+		for(i=0; i < len && !is_upper && is_ascii; i++)
 		{
-			chr=name[i];
+			is_ascii=(name[i].unicode() < 0x80);
+			is_upper=(name[i] >= 'A' && name[i] <= 'Z');
+		}
 
-			if(((i + 1) < (qtd-1)) &&
-				 ((chr >= 0xC2 && chr <= 0xDF) ||
-					(chr >= 0xE0 && chr <= 0xEF)))
-				chr1=name[i+1];
-			else
-				chr1=0;
+		//Names with non ASCII characters are checked considering the UTF-8 multibyte characters
+		if(!is_ascii)
+		{
+			unsigned i, qtd;
 
-			if((i + 2) < (qtd-1) &&
-				 chr >= 0xE0 && chr <= 0xEF)
-				chr2=name[i+2];
-			else
-				chr2=0;
+			is_upper=false;
+			qtd=name.size();
+			i=0;
+			while(i < qtd && !is_upper)
+			{
+				chr=name[i];
 
-			if(chr1!=0 && chr2!=0)
-				i+=3;
-			else if(chr1!=0 && chr2==0)
-				i+=2;
-			else
-				i++;
+				if(((i + 1) < (qtd-1)) &&
+					 ((chr >= 0xC2 && chr <= 0xDF) ||
+						(chr >= 0xE0 && chr <= 0xEF)))
+					chr1=name[i+1];
+				else
+					chr1=0;
 
-			//2 bytes UTF-8 character
-			if((chr  >= 0xC2 && chr <= 0xDF &&
-					chr1 >= 0x80 && chr1 <= 0xBF) ||
+				if((i + 2) < (qtd-1) &&
+					 chr >= 0xE0 && chr <= 0xEF)
+					chr2=name[i+2];
+				else
+					chr2=0;
 
-				 //3 bytes UTF-8 character
-				 (chr  >= 0xE0 && chr <= 0xEF &&
-					chr1 >= 0x80 && chr1 <= 0xBF &&
-					chr2 >= 0x80 && chr2 <= 0xBF) ||
+				if(chr1!=0 && chr2!=0)
+					i+=3;
+				else if(chr1!=0 && chr2==0)
+					i+=2;
+				else
+					i++;
 
-				 chr.isUpper())
-			{
-				is_upper=true;
-			}
+				//2 bytes UTF-8 character
+				if((chr  >= 0xC2 && chr <= 0xDF &&
+						chr1 >= 0x80 && chr1 <= 0xBF) ||
+
+					 //3 bytes UTF-8 character
+					 (chr  >= 0xE0 && chr <= 0xEF &&
+						chr1 >= 0x80 && chr1 <= 0xBF &&
+						chr2 >= 0x80 && chr2 <= 0xBF) ||
 
+					 chr.isUpper())
+				{
+					is_upper=true;
+				}
+			}
 		}
 
 		if(is_upper)
@@ -266,6 +341,42 @@ bool BaseObject::isValidName(const QString &name)
 	}
 }
 
+void BaseObject::setNameModified(void)
+{
+	name_changed[0]=name_changed[1]=true;
+	updateFormattedName();
+	setCodeInvalidated();
+	notifyModification(database, this, NAME_MODIFIED);
+}
+
+void BaseObject::notifyModification(BaseObject *database, BaseObject *object, unsigned mod_type)
+{
+	if(database)
+		database->objectModified(object, mod_type);
+}
+
+void BaseObject::updateFormattedName(void)
+{
+	fmt_name=formatName(obj_name, (obj_type==OBJ_OPERATOR));
+
+	if(schema)
+	{
+		fmt_sch_name=schema->fmt_name;
+		fmt_qual_name=fmt_sch_name + "." + fmt_name;
+	}
+	else
+	{
+		fmt_sch_name.clear();
+		fmt_qual_name=fmt_name;
+	}
+}
+
+void BaseObject::setReferencesModified(void)
+{
+	setCodeInvalidated();
+	notifyModification(database, this, REFS_MODIFIED);
+}
+
 void BaseObject::setDatabase(BaseObject *db)
 {
 	if((db && db->getObjectType()==OBJ_DATABASE) || !db)
@@ -280,6 +391,7 @@ BaseObject *BaseObject::getDatabase(void)
 void BaseObject::setProtected(bool value)
 {
 	is_protected=value;
+	setCodeInvalidated();
 }
 
 void BaseObject::setName(const QString &name)
@@ -302,6 +414,7 @@ void BaseObject::setName(const QString &name)
 		{
 			aux_name.remove('\"');
 			this->obj_name=aux_name;
+			setNameModified();
 		}
 	}
 }
@@ -309,6 +422,7 @@ void BaseObject::setName(const QString &name)
 void BaseObject::setComment(const QString &comment)
 {
 	this->comment=comment;
+	setCodeInvalidated();
 }
 
 bool BaseObject::acceptsSchema(void)
@@ -332,10 +446,15 @@ void BaseObject::setSchema(BaseObject *schema)
 	else
 	{
 		if(acceptsSchema())
+		{
 			this->schema=schema;
+			setNameModified();
+		}
 		else
 			throw Exception(ERR_ASG_INV_SCHEMA_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
+
+	setReferencesModified();
 }
 
 bool BaseObject::acceptsOwner(void)
@@ -360,6 +479,8 @@ void BaseObject::setOwner(BaseObject *owner)
 		else
 			throw Exception(ERR_ASG_ROLE_OBJECT_INV_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
+
+	setReferencesModified();
 }
 
 bool BaseObject::acceptsTablespace(void)
@@ -381,22 +502,25 @@ void BaseObject::setTablespace(BaseObject *tablespace)
 		else
 			throw Exception(ERR_ASG_TABSPC_INV_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
+
+	setReferencesModified();
 }
 
 QString BaseObject::getName(bool format)
 {
 	if(format)
 	{
-		QString aux_name;
-
-		aux_name=formatName(this->obj_name, (obj_type==OBJ_OPERATOR));
-
-		if(this->schema)
-			aux_name=formatName(this->schema->getName()) + "." + aux_name;
-
-		return(aux_name);
+		if(!this->schema)
+			return(fmt_name);
+		/* The cached qualified name is used only if the schema wasn't renamed after its computation,
+			 otherwise the name is built from the current formatted name of the schema */
+		else if(this->schema->fmt_name==fmt_sch_name)
+			return(fmt_qual_name);
+		else
+			return(this->schema->fmt_name + "." + fmt_name);
 	}
-	else return(this->obj_name);
+	else
+		return(this->obj_name);
 }
 
 QString BaseObject::getComment(void)
@@ -512,7 +636,7 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 
 		if(def_type==SchemaParser::XML_DEFINITION && schema)
 		{
-			attributes[ParsersAttributes::SCHEMA]=schema->getCodeDefinition(def_type, true);
+			attributes[ParsersAttributes::SCHEMA]=getReferenceCodeDefinition(schema, def_type);
 		}
 
 		if(def_type==SchemaParser::XML_DEFINITION)
@@ -538,7 +662,7 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 			if(def_type==SchemaParser::SQL_DEFINITION)
 				attributes[ParsersAttributes::TABLESPACE]=tablespace->getName(format);
 			else
-				attributes[ParsersAttributes::TABLESPACE]=tablespace->getCodeDefinition(def_type, true);
+				attributes[ParsersAttributes::TABLESPACE]=getReferenceCodeDefinition(tablespace, def_type);
 		}
 
 		if(owner)
@@ -561,7 +685,7 @@ QString BaseObject::getCodeDefinition(unsigned def_type, bool reduced_form)
 				}
 			}
 			else
-				attributes[ParsersAttributes::OWNER]=owner->getCodeDefinition(def_type, true);
+				attributes[ParsersAttributes::OWNER]=getReferenceCodeDefinition(owner, def_type);
 		}
 
 		if(reduced_form)
@@ -671,5 +795,33 @@ void BaseObject::operator = (BaseObject &obj)
 	this->obj_name=obj.obj_name;
 	this->obj_type=obj.obj_type;
 	this->is_protected=obj.is_protected;
+	setNameModified();
+	setReferencesModified();
 }
 
+void BaseObject::setCodeInvalidated(void)
+{
+	code_cached[SchemaParser::SQL_DEFINITION]=code_cached[SchemaParser::XML_DEFINITION]=false;
+}
+
+bool BaseObject::getCachedCode(unsigned def_type, QString &code)
+{
+	if(def_type > SchemaParser::XML_DEFINITION || !code_cached[def_type] ||
+		 (def_type==SchemaParser::SQL_DEFINITION && cached_pgsql_ver!=SchemaParser::getPgSQLVersion()))
+		return(false);
+
+	code=cached_code[def_type];
+	return(true);
+}
+
+void BaseObject::setCachedCode(unsigned def_type, const QString &code)
+{
+	if(def_type <= SchemaParser::XML_DEFINITION)
+	{
+		cached_code[def_type]=code;
+		code_cached[def_type]=true;
+
+		if(def_type==SchemaParser::SQL_DEFINITION)
+			cached_pgsql_ver=SchemaParser::getPgSQLVersion();
+	}
+}
@@ -32,6 +32,9 @@
 #include "xmlparser.h"
 #include <map>
 #include <QRegExp>
+#include <QMutex>
+#include <QAtomicInt>
+#include <QThreadStorage>
 #include <QStringList>
 
 using namespace ParsersAttributes;
@@ -68,6 +71,20 @@ enum ObjectType {
 	BASE_TABLE
 };
 
+/*! \brief Stores a range of object ids reserved by a thread (see BaseObject::setReservedObjectIds()).
+ The objects created by the thread while the range isn't exhausted receive the ids in [next_id, last_id].
+ An empty range is represented by last_id equal to zero */
+class ObjectIdBlock {
+	public:
+		unsigned next_id, last_id;
+
+		//! \brief Indicates that an id was requested after the range was exhausted
+		bool exhausted;
+
+		ObjectIdBlock(void)
+		{ next_id=1; last_id=0; exhausted=false; }
+};
+
 class BaseObject {
 	private:
 		//! \brief Stores the database wich the object belongs
@@ -77,8 +94,16 @@ class BaseObject {
 		/*! \brief This static attribute is used to generate the unique identifier for objects.
 		 As object instances are created this value ​​are incremented. In some classes
 		 like Schema, DBModel, Tablespace, Role, Type and Function id generators are
-		 used each with a custom different numbering range (see cited classes declaration). */
-		static unsigned global_id;
+		 used each with a custom different numbering range (see cited classes declaration).
+		 The value is incremented atomically since objects can be created by worker threads
+		 (e.g. columns created by relationships connected in parallel, see DatabaseModel::validateRelationships()).
+		 This counter is intentionally shared by all the models of the process: objects are copied between
+		 models keeping their ids, which define the creation order, so the ids can't be generated per model */
+		static QAtomicInt global_id;
+
+		/*! \brief Stores the range of ids reserved by each thread (see setReservedObjectIds()). Like
+		 global_id, from which the ranges are taken, this storage is process-wide and not per model */
+		static QThreadStorage<ObjectIdBlock *> id_blocks;
 
 		/*! \brief Stores the unique identifier for the object. This id is nothing else
 		 than the current value of global_id. This identifier is used
@@ -87,6 +112,49 @@ class BaseObject {
 		 in which the objects were created */
 		unsigned object_id;
 
+		/*! \brief Serializes the code generation of objects referenced by others (e.g. schemas, roles,
+		 functions and operators). Since the code of several model objects can be generated in parallel
+		 (see DatabaseModel::getCodeDefinition()) the same referenced object, which uses its own attributes
+		 map to build the code, can be requested by more than one thread at the same time */
+		static QMutex ref_code_mutex;
+
+		/*! \brief Notifies the database that owns the object (see objectModified()) and updates the
+		 cached formatted names. Must be called every time the name or the schema of the object changes */
+		virtual void setNameModified(void);
+
+		/*! \brief Called on the database that owns the passed object to inform that the object was modified
+		 (see the ???_MODIFIED constants). The database model overrides this method in order to update only the
+		 entries of the object on its indexes. The default implementation does nothing */
+		virtual void objectModified(BaseObject *, unsigned) {}
+
+		//! \brief Calls objectModified() on the passed database, when it's allocated
+		static void notifyModification(BaseObject *database, BaseObject *object, unsigned mod_type);
+
+		/*! \brief Formatted (quoted) name and schema qualified name of the object computed on each change of
+		 name or schema and returned by getName(true). The formatted name of the schema used to build the qualified
+		 name is stored as well in order to detect schema renamings */
+		QString fmt_name, fmt_qual_name, fmt_sch_name;
+
+		/*! \brief Computes the formatted names of the object. This method is called by setNameModified()
+		 and must be called by derived classes that copy the name without notifying its modification */
+		void updateFormattedName(void);
+
+		/*! \brief Notifies the database that owns the object that the references of the object (schemas, owners,
+		 functions, types, columns and so on assigned to it) were changed and invalidates the cached code */
+		virtual void setReferencesModified(void);
+
+		/*! \brief Code definitions (SQL and XML) cached by the database model on the code generation
+		 (see DatabaseModel::writeCodeDefinition()) and the flags indicating whether they are up to date */
+		QString cached_code[2];
+		bool code_cached[2];
+
+		//! \brief PostgreSQL version used to generate the cached SQL code
+		QString cached_pgsql_ver;
+
+		/*! \brief Indicates, for each code definition type, that the name of the object was changed so the
+		 database model must invalidate the cached code of the objects that reference this one */
+		bool name_changed[2];
+
 		//! \brief Objects type count declared on enum ObjectType.
 		static const int OBJECT_TYPE_COUNT=27;
 
@@ -149,6 +217,10 @@ class BaseObject {
 		void setDatabase(BaseObject *db);
 
 	public:
+		//! \brief Modifications notified to the database that owns the object (see objectModified())
+		static const unsigned NAME_MODIFIED=0,
+													REFS_MODIFIED=1;
+
 		BaseObject(void);
 		virtual ~BaseObject(void){}
 
@@ -184,6 +256,31 @@ class BaseObject {
 		//! \brief Returns the current value of the global object id counter
 		static unsigned getGlobalId(void);
 
+		/*! \brief Reserves a block of 'count' consecutive ids on the global object id counter returning the
+		 first one. The reserved ids are not assigned to any object until a thread uses them (see setReservedObjectIds()) */
+		static unsigned reserveObjectIds(unsigned count);
+
+		/*! \brief Makes the objects created by the calling thread receive the ids in the range [first_id, first_id + count - 1],
+		 previously reserved with reserveObjectIds(), in the order they are created. This way a worker thread creates objects
+		 with ids that keep the same order they would have if the objects were created serially. When the range
+		 is exhausted the ids are taken from the global counter again (see isReservedObjectIdsExhausted()).
+		 Passing a zero count discards the thread's range */
+		static void setReservedObjectIds(unsigned first_id, unsigned count);
+
+		/*! \brief Returns whether the calling thread requested more ids than the ones reserved by setReservedObjectIds().
+		 The ids given after the exhaustion come from the global counter so they depend on the timing of the other threads */
+		static bool isReservedObjectIdsExhausted(void);
+
+		/*! \brief Returns a new object id. The id is taken from the range reserved by the calling thread,
+		 if any, or from the global object id counter */
+		static unsigned generateObjectId(void);
+
+		/*! \brief Returns the reduced code definition of an object referenced by another one (e.g. the function
+		 of a trigger). When 'ref_type' is not empty it is assigned to the REF_TYPE attribute of the referenced object
+		 before the generation. This method must be used instead of calling getCodeDefinition() directly on objects
+		 that can be shared between others because the generation is guarded by a lock */
+		static QString getReferenceCodeDefinition(BaseObject *object, unsigned def_type, const QString &ref_type="");
+
 		//! \brief Defines the comment of the object that will be attached to its SQL definition
 		virtual void setComment(const QString &comment);
 
@@ -269,6 +366,16 @@ class BaseObject {
 		//! \brief Returns if the object accepts to has a tablespace assigned
 		bool acceptsTablespace(void);
 
+		//! \brief Discards the cached code definitions of the object forcing them to be generated again
+		virtual void setCodeInvalidated(void);
+
+		/*! \brief Returns the cached code of the passed definition type on 'code'. The method returns false when
+		 the code isn't cached or, for SQL, when it was generated for another PostgreSQL version */
+		bool getCachedCode(unsigned def_type, QString &code);
+
+		//! \brief Stores the code definition generated for the object
+		void setCachedCode(unsigned def_type, const QString &code);
+
 		friend class DatabaseModel;
 };
 
@@ -332,6 +332,7 @@ QString BaseRelationship::getCodeDefinition(void)
 void BaseRelationship::setPoints(const vector<QPointF> &points)
 {
 	this->points=points;
+	setCodeInvalidated();
 }
 
 void BaseRelationship::setLabelDistance(unsigned label_id, QPointF label_dist)
@@ -340,6 +341,7 @@ void BaseRelationship::setLabelDistance(unsigned label_id, QPointF label_dist)
 		throw Exception(ERR_REF_OBJ_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->lables_dist[label_id]=label_dist;
+	setCodeInvalidated();
 }
 
 QPointF BaseRelationship::getLabelDistance(unsigned label_id)
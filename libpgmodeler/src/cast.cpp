@@ -34,6 +34,9 @@ void Cast::setDataType(unsigned type_idx, PgSQLType type)
 
 	//Configures the cast name (in form of signature: cast(src_type, dst_type) )
 	this->obj_name=QString("cast(%1,%2)").arg(~types[SRC_TYPE]).arg(~types[DST_TYPE]);
+	setNameModified();
+
+	setReferencesModified();
 }
 
 void Cast::setCastType(unsigned cast_type)
@@ -43,11 +46,13 @@ void Cast::setCastType(unsigned cast_type)
 		throw Exception(ERR_ASG_INV_TYPE_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->cast_type=cast_type;
+	setCodeInvalidated();
 }
 
 void Cast::setInOut(bool value)
 {
 	is_in_out=value;
+	setCodeInvalidated();
 }
 
 void Cast::setCastFunction(Function *cast_func)
@@ -102,6 +107,8 @@ void Cast::setCastFunction(Function *cast_func)
 										ERR_ASG_FUNCTION_INV_RET_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->cast_function=cast_func;
+
+	setReferencesModified();
 }
 
 PgSQLType Cast::getDataType(unsigned type_idx)
@@ -145,7 +152,7 @@ QString Cast::getCodeDefinition(unsigned def_type)
 		if(def_type==SchemaParser::SQL_DEFINITION)
 			attributes[ParsersAttributes::SIGNATURE]=cast_function->getSignature();
 		else
-			attributes[ParsersAttributes::SIGNATURE]=cast_function->getCodeDefinition(def_type, true);
+			attributes[ParsersAttributes::SIGNATURE]=getReferenceCodeDefinition(cast_function, def_type);
 	}
 
 	if(cast_type==ASSIGNMENT)
@@ -39,16 +39,20 @@ void Column::setType(PgSQLType type)
 		throw Exception(ERR_ASG_PSDTYPE_COLUMN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	else
 		this->type=type;
+
+	setReferencesModified();
 }
 
 void Column::setDefaultValue(const QString &value)
 {
 	default_value=value;
+	setCodeInvalidated();
 }
 
 void Column::setNotNull(bool value)
 {
 	not_null=value;
+	setCodeInvalidated();
 }
 
 PgSQLType Column::getType(void)
@@ -109,5 +113,8 @@ void Column::operator = (Column &col)
 	this->add_by_copy=false;
 	this->add_by_generalization=false;
 	this->add_by_linking=false;
+
+	//Updates the formatted name and the column's entry on the parent table names index
+	setNameModified();
 }
 
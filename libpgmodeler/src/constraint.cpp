@@ -34,6 +34,7 @@ Constraint::~Constraint(void)
 void Constraint::setConstraintType(ConstraintType constr_type)
 {
 	this->constr_type=constr_type;
+	setCodeInvalidated();
 }
 
 void Constraint::setActionType(ActionType action_type, bool upd)
@@ -42,11 +43,14 @@ void Constraint::setActionType(ActionType action_type, bool upd)
 		this->upd_action=action_type;
 	else
 		this->del_action=action_type;
+
+	setCodeInvalidated();
 }
 
 void Constraint::setCheckExpression(const QString &expr)
 {
 	check_expr=expr;
+	setCodeInvalidated();
 }
 
 bool Constraint::isColumnExists(Column *column, unsigned col_type)
@@ -101,6 +105,8 @@ void Constraint::addColumn(Column *column, unsigned col_type)
 				columns.push_back(column);
 		}
 	}
+
+	setReferencesModified();
 }
 
 void Constraint::setTablespace(Tablespace *tabspc)
@@ -166,27 +172,33 @@ void Constraint::setColumnsAttribute(unsigned col_type, unsigned def_type, bool
 void Constraint::setReferencedTable(BaseObject *tab_ref)
 {
 	this->ref_table=tab_ref;
+
+	setReferencesModified();
 }
 
 void Constraint::setDeferralType(DeferralType deferral_type)
 {
 	this->deferral_type=deferral_type;
+	setCodeInvalidated();
 }
 
 void Constraint::setDeferrable(bool value)
 {
 	deferrable=value;
+	setCodeInvalidated();
 }
 
 void Constraint::setMatchType(MatchType match_type)
 {
 	this->match_type=match_type;
+	setCodeInvalidated();
 }
 
 void Constraint::setFillFactor(unsigned factor)
 {
 	if(factor < 10) factor=10;
 	fill_factor=factor;
+	setCodeInvalidated();
 }
 
 unsigned Constraint::getFillFactor(void)
@@ -264,6 +276,8 @@ void Constraint::removeColumns(void)
 {
 	columns.clear();
 	ref_columns.clear();
+
+	setReferencesModified();
 }
 
 void Constraint::removeColumn(const QString &name, unsigned col_type)
@@ -294,6 +308,8 @@ void Constraint::removeColumn(const QString &name, unsigned col_type)
 		}
 		else itr++;
 	}
+
+	setReferencesModified();
 }
 
 DeferralType Constraint::getDeferralType(void)
@@ -29,6 +29,8 @@ void Conversion::setEncoding(unsigned encoding_idx, EncodingType encoding_type)
 	else
 		//Raises an error if the encoding index is invalid
 		throw Exception(ERR_REF_TYPE_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	setCodeInvalidated();
 }
 
 void Conversion::setConversionFunction(Function *conv_func)
@@ -65,11 +67,14 @@ void Conversion::setConversionFunction(Function *conv_func)
 										ERR_ASG_FUNCTION_INV_RET_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->conversion_func=conv_func;
+
+	setReferencesModified();
 }
 
 void Conversion::setDefault(bool value)
 {
 	is_default=value;
+	setCodeInvalidated();
 }
 
 EncodingType Conversion::getEncoding(unsigned encoding_idx)
@@ -101,7 +106,7 @@ QString Conversion::getCodeDefinition(unsigned def_type)
 		if(def_type==SchemaParser::SQL_DEFINITION)
 			attributes[ParsersAttributes::FUNCTION]=conversion_func->getName(true);
 		else
-			attributes[ParsersAttributes::FUNCTION]=conversion_func->getCodeDefinition(def_type, true);
+			attributes[ParsersAttributes::FUNCTION]=getReferenceCodeDefinition(conversion_func, def_type);
 	}
 
 	return(BaseObject::__getCodeDefinition(def_type));
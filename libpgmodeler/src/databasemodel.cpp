@@ -1,16 +1,22 @@
 #include "databasemodel.h"
 
-unsigned DatabaseModel::dbmodel_id=20000;
+QAtomicInt DatabaseModel::dbmodel_id(20000);
 
-DatabaseModel::DatabaseModel(void)
+DatabaseModel::DatabaseModel(void) : mod_mutex(QMutex::Recursive)
 {
-	object_id=DatabaseModel::dbmodel_id++;
+	object_id=DatabaseModel::dbmodel_id.fetchAndAddOrdered(1);
 
 	obj_type=OBJ_DATABASE;
 	BaseObject::setName(QObject::trUtf8("new_database").toUtf8());
+	user_types.setModel(this);
 
 	conn_limit=-1;
 	loading_model=false;
+
+	for(unsigned i=0; i < static_cast<unsigned>(BaseObject::OBJECT_TYPE_COUNT); i++)
+		valid_positions[i]=0;
+
+	outdated_refs.insert(this);
 	attributes[ParsersAttributes::ENCODING]="";
 	attributes[ParsersAttributes::TEMPLATE_DB]="";
 	attributes[ParsersAttributes::CONN_LIMIT]="";
@@ -385,7 +391,10 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 	obj_list=getObjectList(object->getObjectType());
 
 	if(obj_idx < 0 || obj_idx >= static_cast<int>(obj_list->size()))
+	{
 		obj_list->push_back(object);
+		idx=obj_list->size()-1;
+	}
 	else
 	{
 		if(obj_idx >=0 && idx < 0)
@@ -396,11 +405,29 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 		if(obj_list->size() > 0)
 			obj_list->insert((obj_list->begin() + idx), object);
 		else
+		{
 			obj_list->push_back(object);
+			idx=0;
+		}
 	}
 
+	/* When the object is appended and the positions of the previous ones are up to date its position is valid too,
+		 otherwise the positions from the insertion point onwards must be recomputed (see getObjectPosition()) */
+	if(idx==static_cast<int>(valid_positions[obj_type]) && idx==static_cast<int>(obj_list->size()-1))
+		valid_positions[obj_type]++;
+	else if(idx < static_cast<int>(valid_positions[obj_type]))
+		valid_positions[obj_type]=idx;
+
+	obj_positions[object]=idx;
 	object->setDatabase(this);
 
+	if(isNameIndexed(obj_type))
+		setNameIndexEntry(object);
+
+	//The edges of the object are inserted on the references graph on its next update
+	if(obj_type!=OBJ_PERMISSION)
+		objectModified(object, REFS_MODIFIED);
+
 	if(!signalsBlocked())
 		emit s_objectAdded(object);
 }
@@ -422,19 +449,22 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx)
 		else
 		{
 			if(obj_idx < 0)
-			{
-				if(obj_type!=OBJ_FUNCTION && obj_type!=OBJ_OPERATOR)
-					getObject(object->getName(true), obj_type, obj_idx);
-				else if(obj_type==OBJ_FUNCTION)
-					getObject(dynamic_cast<Function *>(object)->getSignature(), obj_type, obj_idx);
-				else
-					getObject(dynamic_cast<Operator *>(object)->getSignature(), obj_type, obj_idx);
-			}
+				obj_idx=getObjectPosition(object);
 
 			if(obj_idx >= 0)
 			{
 				removePermissions(object);
+
+				if(isNameIndexed(obj_type))
+					setNameIndexEntry(obj_list->at(obj_idx), true);
+
+				removeReferencesGraphEntries(obj_list->at(obj_idx));
+
+				obj_positions.remove(obj_list->at(obj_idx));
 				obj_list->erase(obj_list->begin() + obj_idx);
+
+				if(obj_idx < static_cast<int>(valid_positions[obj_type]))
+					valid_positions[obj_type]=obj_idx;
 			}
 		}
 
@@ -475,7 +505,7 @@ BaseObject *DatabaseModel::getObject(const QString &name, ObjectType obj_type, i
 	vector<BaseObject *>::iterator itr, itr_end;
 	bool found=false;
 	int count;
-	QString aux_name, aux_name1;
+	QString aux_name1;
 
 	obj_list=getObjectList(obj_type);
 
@@ -491,41 +521,198 @@ BaseObject *DatabaseModel::getObject(const QString &name, ObjectType obj_type, i
 		count=aux_name1.count(QChar('\0'));
 		if(count >=1) aux_name1.chop(count);
 
-		if(obj_type!=OBJ_FUNCTION && obj_type!=OBJ_OPERATOR)
+		if(isNameIndexed(obj_type))
+		{
+			object=getIndexedObject(aux_name1, obj_type);
+
+			if(object)
+				obj_idx=getObjectPosition(object);
+		}
+		else
 		{
 			aux_name1=BaseObject::formatName(aux_name1);
 
 			while(itr!=itr_end && !found)
 			{
-				aux_name=(*itr)->getName(true);
-				found=(aux_name==aux_name1);
+				found=((*itr)->getName(true)==aux_name1);
 				if(!found) itr++;
 			}
+
+			if(found)
+			{
+				object=(*itr);
+				obj_idx=(itr-obj_list->begin());
+			}
 		}
-		else
+	}
+
+	return(object);
+}
+
+void DatabaseModel::updateNameIndex(void)
+{
+	QMutexLocker locker(&mod_mutex);
+
+	if(!renamed_objs.isEmpty())
+	{
+		ObjectType usr_types[]={ OBJ_TABLE, OBJ_SEQUENCE, OBJ_DOMAIN, OBJ_TYPE };
+		vector<BaseObject *> *obj_list=NULL;
+		vector<BaseObject *>::iterator itr, itr_end;
+		QSet<BaseObject *>::iterator itr_obj;
+		QSet<BaseObject *> schemas;
+		bool upd_operators=false;
+		unsigned i;
+		int type_id;
+
+		for(itr_obj=renamed_objs.begin(); itr_obj!=renamed_objs.end(); itr_obj++)
 		{
-			QString signature;
+			if((*itr_obj)->getObjectType()==OBJ_SCHEMA)
+				schemas.insert(*itr_obj);
 
-			while(itr!=itr_end && !found)
+			for(i=0; i < sizeof(usr_types)/sizeof(ObjectType) && !upd_operators; i++)
+				upd_operators=((*itr_obj)->getObjectType()==usr_types[i]);
+		}
+
+		//The keys of the objects on a renamed schema are qualified by the schema name so they're updated too
+		for(type_id=0; type_id < BaseObject::OBJECT_TYPE_COUNT && !schemas.isEmpty(); type_id++)
+		{
+			if(isNameIndexed(static_cast<ObjectType>(type_id)))
 			{
-				/* Special case for functions/operators: to check duplicity the signature must be
-			 compared and not only the name */
-				if(obj_type==OBJ_FUNCTION)
-					signature=dynamic_cast<Function *>(*itr)->getSignature();
-				else
-					signature=dynamic_cast<Operator *>(*itr)->getSignature();
+				obj_list=getObjectList(static_cast<ObjectType>(type_id));
+				itr=obj_list->begin();
+				itr_end=obj_list->end();
 
-				found=(signature==aux_name1);
-				if(!found) itr++;
+				while(itr!=itr_end)
+				{
+					if((*itr)->getSchema() && schemas.contains((*itr)->getSchema()))
+						renamed_objs.insert(*itr);
+					itr++;
+				}
 			}
 		}
 
-		if(found)
+		//The signatures of the operators contains the names of the user defined types used as arguments
+		if(upd_operators)
 		{
-			object=(*itr);
-			obj_idx=(itr-obj_list->begin());
+			for(itr=operators.begin(); itr!=operators.end(); itr++)
+				renamed_objs.insert(*itr);
+		}
+
+		for(itr_obj=renamed_objs.begin(); itr_obj!=renamed_objs.end(); itr_obj++)
+			setNameIndexEntry(*itr_obj);
+
+		renamed_objs.clear();
+	}
+}
+
+void DatabaseModel::setNameIndexEntry(BaseObject *object, bool remove)
+{
+	ObjectType obj_type=object->getObjectType();
+	QHash<BaseObject *, QString>::iterator itr=name_keys.find(object);
+
+	if(itr!=name_keys.end())
+	{
+		name_index[obj_type].remove(itr.value(), object);
+		name_keys.erase(itr);
+	}
+
+	if(!remove)
+	{
+		QString key=getNameIndexKey(object);
+		name_index[obj_type].insert(key, object);
+		name_keys[object]=key;
+	}
+	else
+	{
+		mod_mutex.lock();
+		renamed_objs.remove(object);
+		mod_mutex.unlock();
+	}
+}
+
+int DatabaseModel::getObjectPosition(BaseObject *object)
+{
+	ObjectType obj_type=object->getObjectType();
+	QHash<BaseObject *, unsigned>::iterator itr=obj_positions.find(object);
+
+	if(itr==obj_positions.end())
+		return(-1);
+	else
+	{
+		//Recomputes the positions shifted by insertions and removals on the object's list
+		if(itr.value() >= valid_positions[obj_type])
+		{
+			vector<BaseObject *> *obj_list=getObjectList(obj_type);
+			unsigned i, count=obj_list->size();
+
+			for(i=valid_positions[obj_type]; i < count; i++)
+				obj_positions[obj_list->at(i)]=i;
+
+			valid_positions[obj_type]=count;
 		}
-		else obj_idx=-1;
+
+		return(obj_positions.value(object));
+	}
+}
+
+void DatabaseModel::objectModified(BaseObject *object, unsigned mod_type)
+{
+	QMutexLocker locker(&mod_mutex);
+
+	/* Only the objects on the model are considered since copies of them (e.g. the ones
+		 used by the operation list) keep the reference to the database */
+	if(object && obj_positions.contains(object))
+	{
+		if(mod_type==NAME_MODIFIED && isNameIndexed(object->getObjectType()))
+			renamed_objs.insert(object);
+		else if(mod_type==REFS_MODIFIED)
+			outdated_refs.insert(object);
+	}
+	else if(object==this && mod_type==REFS_MODIFIED)
+		outdated_refs.insert(object);
+}
+
+bool DatabaseModel::isNameIndexed(ObjectType obj_type)
+{
+	return(obj_type!=OBJ_PERMISSION && getObjectList(obj_type)!=NULL);
+}
+
+QString DatabaseModel::getNameIndexKey(BaseObject *object)
+{
+	/* Special case for functions/operators: to check duplicity the signature must be
+		 compared and not only the name */
+	if(object->getObjectType()==OBJ_FUNCTION)
+		return(dynamic_cast<Function *>(object)->getSignature());
+	else if(object->getObjectType()==OBJ_OPERATOR)
+		return(dynamic_cast<Operator *>(object)->getSignature());
+	else
+		return(object->getName(true));
+}
+
+BaseObject *DatabaseModel::getIndexedObject(const QString &name, ObjectType obj_type)
+{
+	QMultiHash<QString, BaseObject *>::const_iterator itr;
+	BaseObject *object=NULL;
+	QString aux_name=name;
+	int count;
+
+	count=aux_name.count(QChar('\0'));
+	if(count >=1) aux_name.chop(count);
+
+	updateNameIndex();
+
+	//Functions and operators are indexed by their signatures which are compared without formatting
+	if(obj_type!=OBJ_FUNCTION && obj_type!=OBJ_OPERATOR)
+		aux_name=BaseObject::formatName(aux_name);
+
+	itr=name_index[obj_type].constFind(aux_name);
+
+	//In case of duplicated keys the first object on the list is returned (like the sequential search)
+	while(itr!=name_index[obj_type].constEnd() && itr.key()==aux_name)
+	{
+		if(!object || getObjectPosition(itr.value()) < getObjectPosition(object))
+			object=itr.value();
+		itr++;
 	}
 
 	return(object);
@@ -657,6 +844,7 @@ void DatabaseModel::destroyObjects(void)
 	unsigned i;
 
 	disconnectRelationships();
+	clearSpecialObjects();
 
 	for(i=0; i < 20; i++)
 	{
@@ -673,6 +861,26 @@ void DatabaseModel::destroyObjects(void)
 			list->pop_back();
 		}
 	}
+
+	//Clears the indexes since all the objects were destroyed
+	for(i=0; i < static_cast<unsigned>(BaseObject::OBJECT_TYPE_COUNT); i++)
+	{
+		name_index[i].clear();
+		valid_positions[i]=0;
+	}
+
+	name_keys.clear();
+	obj_positions.clear();
+	mod_mutex.lock();
+	renamed_objs.clear();
+	mod_mutex.unlock();
+
+	mod_mutex.lock();
+	obj_references.clear();
+	ref_edges.clear();
+	outdated_refs.clear();
+	outdated_refs.insert(this);
+	mod_mutex.unlock();
 }
 
 void DatabaseModel::addTable(Table *table, int obj_idx)
@@ -994,7 +1202,7 @@ void DatabaseModel::updateViewRelationships(View *view)
 	}
 }
 
-void DatabaseModel::disconnectRelationships(void)
+void DatabaseModel::disconnectRelationships(QSet<BaseObject *> *rels)
 {
 	try
 	{
@@ -1011,13 +1219,17 @@ void DatabaseModel::disconnectRelationships(void)
 			base_rel=dynamic_cast<BaseRelationship *>(*ritr_rel);
 			ritr_rel++;
 
-			if(base_rel->getObjectType()==OBJ_RELATIONSHIP)
+			//When a relationship set is specified only its relationships are disconnected
+			if(!rels || rels->contains(base_rel))
 			{
-				rel=dynamic_cast<Relationship *>(base_rel);
-				rel->disconnectRelationship();
+				if(base_rel->getObjectType()==OBJ_RELATIONSHIP)
+				{
+					rel=dynamic_cast<Relationship *>(base_rel);
+					rel->disconnectRelationship();
+				}
+				else
+					base_rel->disconnectRelationship();
 			}
-			else
-				base_rel->disconnectRelationship();
 		}
 	}
 	catch(Exception &e)
@@ -1028,26 +1240,44 @@ void DatabaseModel::disconnectRelationships(void)
 
 void DatabaseModel::validateRelationships(void)
 {
-	vector<BaseObject *>::iterator itr, itr_end, itr_ant;
+	QSet<BaseObject *> tables;
+	validateRelationships(tables);
+}
+
+void DatabaseModel::validateRelationships(QSet<BaseObject *> &tables)
+{
+	vector<BaseObject *>::iterator itr, itr_end;
 	Relationship *rel=NULL;
 	BaseRelationship *base_rel=NULL;
-	vector<BaseObject *> vet_rel, vet_rel_inv, rels;
+	vector<BaseObject *> vet_rel, vet_rel_inv, rels, tabs_queue;
 	bool found_inval_rel;
 	vector<Exception> errors;
-	map<unsigned, QString>::iterator itr1, itr1_end;
+	map<unsigned, SpecialObjectSnapshot>::iterator itr1, itr1_end;
 	map<unsigned, Exception> error_map;
 	map<unsigned, Exception>::iterator itr2, itr2_end;
-	unsigned idx;
+	unsigned idx, i, i1;
 	vector<Schema *> schemas;
-	BaseTable *tab1=NULL, *tab2=NULL;
-
-	itr=relationships.begin();
-	itr_end=relationships.end();
+	BaseTable *tab1=NULL, *tab2=NULL, *aux_tabs[2];
+	QSet<BaseObject *> affected_tabs, affected_rels, inval_rels;
+	QHash<BaseObject *, vector<BaseObject *> > tab_rels;
+	vector<BaseObject *>::iterator itr_tr, itr_tr_end;
+	vector<RelConnectionJob> rel_jobs;
+	QHash<BaseObject *, unsigned> rel_comps;
+	QSet<BaseGraphicObject *> blocked_objs;
+	QSet<BaseGraphicObject *>::iterator itr_blk;
+	BaseGraphicObject *graph_objs[3];
 
 	do
 	{
 		//Initializes the flag that indicates that some invalid relatioship was found.
 		found_inval_rel=false;
+		affected_tabs=tables;
+		affected_rels.clear();
+		inval_rels.clear();
+		tab_rels.clear();
+
+		itr=relationships.begin();
+		itr_end=relationships.end();
 
 		while(itr!=itr_end)
 		{
@@ -1059,31 +1289,103 @@ void DatabaseModel::validateRelationships(void)
 			{
 				//Makes a cast to the correct object class
 				rel=dynamic_cast<Relationship *>(base_rel);
+				tab1=rel->getTable(BaseRelationship::SRC_TABLE);
+				tab2=rel->getTable(BaseRelationship::DST_TABLE);
+
+				//Stores the relationships linked to each table in order to propagate the invalidation
+				tab_rels[tab1].push_back(rel);
+				if(tab2!=tab1)
+					tab_rels[tab2].push_back(rel);
 
-				//If the relationships is invalid
+				/* If the relationships is invalid (disconnected relationships are considered invalid too)
+				 it and both of its tables are the starting point of the revalidation */
 				if(rel->isInvalidated())
 				{
-					//Inserts it to the invalid relationship vector
-					vet_rel_inv.push_back(base_rel);
+					affected_rels.insert(rel);
+					inval_rels.insert(rel);
+					affected_tabs.insert(tab1);
+					affected_tabs.insert(tab2);
 
 					//Marks the flag indicating the at least one relationship was found invalidated
 					found_inval_rel=true;
 				}
+			}
+		}
+
+		/* Propagates the invalidation through the relationship graph: every relationship linked to
+		 an affected table must be reconnected and its receiver table becomes affected as well since
+		 the columns propagated to it will be recreated. Relationships and tables that can't be
+		 reached from the invalidated ones are kept untouched */
+		tabs_queue.assign(affected_tabs.begin(), affected_tabs.end());
+
+		while(!tabs_queue.empty())
+		{
+			itr_tr=tab_rels[tabs_queue.back()].begin();
+			itr_tr_end=tab_rels[tabs_queue.back()].end();
+			tabs_queue.pop_back();
+
+			while(itr_tr!=itr_tr_end)
+			{
+				rel=dynamic_cast<Relationship *>(*itr_tr);
+				itr_tr++;
+
+				if(!affected_rels.contains(rel))
+				{
+					affected_rels.insert(rel);
+					aux_tabs[0]=rel->getReceiverTable();
+					aux_tabs[1]=NULL;
+
+					//When the receiver can't be determined both tables are considered affected
+					if(!aux_tabs[0])
+					{
+						aux_tabs[0]=rel->getTable(BaseRelationship::SRC_TABLE);
+						aux_tabs[1]=rel->getTable(BaseRelationship::DST_TABLE);
+					}
+
+					for(i=0; i < 2; i++)
+					{
+						if(aux_tabs[i] && !affected_tabs.contains(aux_tabs[i]))
+						{
+							affected_tabs.insert(aux_tabs[i]);
+							tabs_queue.push_back(aux_tabs[i]);
+						}
+					}
+				}
+			}
+		}
+
+		//The seed tables are used only on the first iteration
+		tables.clear();
+
+		/* Separates the affected relationships in valid and invalid ones keeping the order
+		 in which they were created */
+		itr=relationships.begin();
+		itr_end=relationships.end();
+
+		while(itr!=itr_end)
+		{
+			base_rel=dynamic_cast<BaseRelationship *>(*itr);
+			itr++;
+
+			if(affected_rels.contains(base_rel))
+			{
+				if(inval_rels.contains(base_rel))
+					vet_rel_inv.push_back(base_rel);
 				else
-					//Otherwise inserts the relationship on the valid relationships
 					vet_rel.push_back(base_rel);
 			}
 		}
 
-		//If there is some invalidated relationship or special objects to be recreated
-		if(found_inval_rel || !xml_special_objs.empty())
+		//If there is some affected relationship or special objects to be recreated
+		if(!affected_rels.empty() || !special_objs.empty())
 		{
-			//Stores the special objects definition if there is some invalidated relationships
-			if(!loading_model && xml_special_objs.empty())
-				storeSpecialObjectsXML();
+			/* Stores the definition of the special objects that references columns
+			 added by relationship on the affected tables */
+			if(!loading_model && special_objs.empty())
+				storeSpecialObjectsXML(&affected_tabs);
 
-			//Disconnects all the relationship
-			disconnectRelationships();
+			//Disconnects only the affected relationships
+			disconnectRelationships(&affected_rels);
 
 			/* Merges the two lists (valid and invalid relationships),
 			taking care to insert the invalid ones at the end of the list */
@@ -1092,63 +1394,161 @@ void DatabaseModel::validateRelationships(void)
 			vet_rel.clear();
 			vet_rel_inv.clear();
 
-			//Walking through the created list connecting the relationships
-			itr=rels.begin();
-			itr_end=rels.end();
-			idx=0;
+			/* Partitions the relationships in groups of tables linked by them. Relationships of different
+			 groups can't interact with each other so each group is connected by a worker thread. Inside a
+			 group the relationships are connected in the same order of the merged list */
+			rel_jobs.clear();
+			rel_comps.clear();
 
-			while(itr!=itr_end)
+			for(itr=rels.begin(); itr!=rels.end(); itr++)
 			{
-				rel=dynamic_cast<Relationship *>(*itr);
+				if(!rel_comps.contains(*itr))
+				{
+					idx=rel_jobs.size();
+					rel_jobs.push_back(RelConnectionJob());
+					rel_jobs.back().thread=QThread::currentThread();
+					rel_comps[*itr]=idx;
 
-				//Stores the current iterator in a auxiliary one to remove from list in case of error
-				itr_ant=itr;
-				itr++;
+					tabs_queue.clear();
+					tabs_queue.push_back(dynamic_cast<Relationship *>(*itr)->getTable(BaseRelationship::SRC_TABLE));
+					tabs_queue.push_back(dynamic_cast<Relationship *>(*itr)->getTable(BaseRelationship::DST_TABLE));
+
+					while(!tabs_queue.empty())
+					{
+						itr_tr=tab_rels[tabs_queue.back()].begin();
+						itr_tr_end=tab_rels[tabs_queue.back()].end();
+						tabs_queue.pop_back();
+
+						while(itr_tr!=itr_tr_end)
+						{
+							rel=dynamic_cast<Relationship *>(*itr_tr);
+							itr_tr++;
+
+							if(affected_rels.contains(rel) && !rel_comps.contains(rel))
+							{
+								rel_comps[rel]=idx;
+								tabs_queue.push_back(rel->getTable(BaseRelationship::SRC_TABLE));
+								tabs_queue.push_back(rel->getTable(BaseRelationship::DST_TABLE));
+							}
+						}
+					}
+				}
+
+				rel_jobs[rel_comps[*itr]].relationships.push_back(dynamic_cast<Relationship *>(*itr));
+			}
+
+			blocked_objs.clear();
 
-				try
+			if(rel_jobs.size() > 1)
+			{
+				/* Reserves for each job a block of ids estimated to hold the objects created by its relationships
+				 (columns and constraints copied from both tables plus the objects created by the relationship itself).
+				 The blocks are reserved in the jobs order so the ids of the created objects don't depend on the order
+				 the worker threads run. The exact amount isn't known before the connection, so the jobs that exhaust
+				 their blocks are connected again serially (see below).
+
+				 The signals of the relationships and tables are blocked while the jobs run since they are connected
+				 to the graphical views, which can only be handled by the GUI thread. The modification signals are
+				 emitted after the jobs finish (see below) */
+				for(idx=0; idx < rel_jobs.size(); idx++)
 				{
-					//Try to connect the relationship
-					rel->connectRelationship();
+					for(i=0; i < rel_jobs[idx].relationships.size(); i++)
+					{
+						rel=rel_jobs[idx].relationships[i];
+						tab1=rel->getTable(BaseRelationship::SRC_TABLE);
+						tab2=rel->getTable(BaseRelationship::DST_TABLE);
+						rel_jobs[idx].id_count+=dynamic_cast<Table *>(tab1)->getColumnCount() +
+																		dynamic_cast<Table *>(tab1)->getConstraintCount() +
+																		dynamic_cast<Table *>(tab2)->getColumnCount() +
+																		dynamic_cast<Table *>(tab2)->getConstraintCount() +
+																		REL_RESERVED_IDS;
+
+						graph_objs[0]=rel;
+						graph_objs[1]=rel->getTable(BaseRelationship::SRC_TABLE);
+						graph_objs[2]=rel->getTable(BaseRelationship::DST_TABLE);
+
+						for(i1=0; i1 < 3; i1++)
+						{
+							if(!graph_objs[i1]->signalsBlocked())
+							{
+								graph_objs[i1]->blockSignals(true);
+								blocked_objs.insert(graph_objs[i1]);
+							}
+						}
+					}
+
+					rel_jobs[idx].first_id=BaseObject::reserveObjectIds(rel_jobs[idx].id_count);
+				}
 
-					//Storing the schemas on a auxiliary vector to update them later
-					tab1=rel->getTable(BaseRelationship::SRC_TABLE);
-					tab2=rel->getTable(BaseRelationship::DST_TABLE);
+				QtConcurrent::blockingMap(rel_jobs, DatabaseModel::connectRelationships);
 
-					if(std::find(schemas.begin(), schemas.end(), tab1->getSchema())==schemas.end())
-						schemas.push_back(dynamic_cast<Schema *>(tab1->getSchema()));
-					else if(tab2!=tab1 &&
-									std::find(schemas.begin(), schemas.end(), tab1->getSchema())==schemas.end())
-						schemas.push_back(dynamic_cast<Schema *>(tab2->getSchema()));
+				/* The objects of a job that exhausted its block received part of their ids from the global counter,
+				 which depends on the timing of the threads. Its relationships are disconnected (from the last to the
+				 first) and connected again by this thread, in the jobs order, taking the ids from the global counter */
+				for(idx=0; idx < rel_jobs.size(); idx++)
+				{
+					if(rel_jobs[idx].ids_exhausted)
+					{
+						for(i=rel_jobs[idx].relationships.size(); i > 0; i--)
+							rel_jobs[idx].relationships[i-1]->disconnectRelationship();
 
-					idx++;
+						rel_jobs[idx].failed_rels.clear();
+						rel_jobs[idx].errors.clear();
+						rel_jobs[idx].first_id=rel_jobs[idx].id_count=0;
+						connectRelationships(rel_jobs[idx]);
+					}
 				}
+			}
+			else if(!rel_jobs.empty())
+				connectRelationships(rel_jobs[0]);
+
+			for(idx=0; idx < rel_jobs.size(); idx++)
+			{
 				/* Case some error is raised during the connection the relationship is
-			 permanently invalidated and need to be removed from the model */
-				catch(Exception &e)
+				 permanently invalidated and need to be removed from the model */
+				for(i=0; i < rel_jobs[idx].failed_rels.size(); i++)
 				{
-					//Removes the relationship
-					__removeObject(rel);
+					rel=rel_jobs[idx].failed_rels[i];
 
-					//Removes the iterator that stores the relationship from the list
-					rels.erase(itr_ant);
-
-					/* Points the searching to the iterator immediately after the removed iterator
-				evicting to walk on the list from the first item */
-					itr_end=rels.end();
-					itr=rels.begin() + idx;
+					if(blocked_objs.contains(rel))
+					{
+						rel->blockSignals(false);
+						blocked_objs.remove(rel);
+					}
 
+					__removeObject(rel);
+					rels.erase(std::find(rels.begin(), rels.end(), rel));
 					delete(rel);
 
 					//Stores the error raised in a list
-					errors.push_back(e);
+					errors.push_back(rel_jobs[idx].errors[i]);
 				}
 			}
 
-			itr=rels.begin();
+			//Restores the signals blocked during the parallel connection emitting the modifications on the GUI thread
+			for(itr_blk=blocked_objs.begin(); itr_blk!=blocked_objs.end(); itr_blk++)
+			{
+				(*itr_blk)->blockSignals(false);
+				(*itr_blk)->setModified(true);
+			}
+
+			//Storing the schemas on a auxiliary vector to update them later
+			for(itr=rels.begin(); itr!=rels.end(); itr++)
+			{
+				rel=dynamic_cast<Relationship *>(*itr);
+				tab1=rel->getTable(BaseRelationship::SRC_TABLE);
+				tab2=rel->getTable(BaseRelationship::DST_TABLE);
+
+				if(std::find(schemas.begin(), schemas.end(), tab1->getSchema())==schemas.end())
+					schemas.push_back(dynamic_cast<Schema *>(tab1->getSchema()));
+
+				if(std::find(schemas.begin(), schemas.end(), tab2->getSchema())==schemas.end())
+					schemas.push_back(dynamic_cast<Schema *>(tab2->getSchema()));
+			}
 
 			//Recreating the special objects
-			itr1=xml_special_objs.begin();
-			itr1_end=xml_special_objs.end();
+			itr1=special_objs.begin();
+			itr1_end=special_objs.end();
 
 			//The special objects are created only when the model is not being loaded
 			if(!loading_model && itr1!=itr1_end)
@@ -1165,12 +1565,12 @@ void DatabaseModel::validateRelationships(void)
 						if(error_map.count(itr1->first))
 							error_map.erase(error_map.find(itr1->first));
 
-						//Removes the definition of the special object when it is created successfully
-						xml_special_objs.erase(itr1);
+						//Removes the special object from the map when it is created successfully
+						special_objs.erase(itr1);
 
 						//Restart the special object creation
-						itr1=xml_special_objs.begin();
-						itr1_end=xml_special_objs.end();
+						itr1=special_objs.begin();
+						itr1_end=special_objs.end();
 					}
 					catch(Exception &e)
 					{
@@ -1205,7 +1605,7 @@ void DatabaseModel::validateRelationships(void)
 	//If errors were caught on the above executions they will be redirected to the user
 	if(!errors.empty())
 	{
-		xml_special_objs.clear();
+		clearSpecialObjects();
 
 		/* Revalidates the fk relationships at this points because some fks must be removed due
 		 to special object invalidation */
@@ -1326,7 +1726,59 @@ void DatabaseModel::checkRelationshipRedundancy(Relationship *rel)
 	}
 }
 
-void DatabaseModel::storeSpecialObjectsXML(void)
+bool DatabaseModel::isReferencingColumns(BaseObject *object, QSet<BaseObject *> &columns)
+{
+	ObjectType obj_type;
+	unsigned count, i, col_type;
+	bool found=false;
+
+	if(!object || columns.empty())
+		return(false);
+
+	obj_type=object->getObjectType();
+
+	if(obj_type==OBJ_CONSTRAINT)
+	{
+		Constraint *constr=dynamic_cast<Constraint *>(object);
+
+		for(col_type=Constraint::SOURCE_COLS; col_type <= Constraint::REFERENCED_COLS && !found; col_type++)
+		{
+			count=constr->getColumnCount(col_type);
+			for(i=0; i < count && !found; i++)
+				found=columns.contains(constr->getColumn(i, col_type));
+		}
+	}
+	else if(obj_type==OBJ_TRIGGER)
+	{
+		Trigger *trigger=dynamic_cast<Trigger *>(object);
+
+		count=trigger->getColumnCount();
+		for(i=0; i < count && !found; i++)
+			found=columns.contains(trigger->getColumn(i));
+	}
+	else if(obj_type==OBJ_INDEX)
+	{
+		Index *index=dynamic_cast<Index *>(object);
+
+		count=index->getElementCount();
+		for(i=0; i < count && !found; i++)
+			found=columns.contains(index->getElement(i).getColumn());
+	}
+	else if(obj_type==OBJ_SEQUENCE)
+		found=columns.contains(dynamic_cast<Sequence *>(object)->getOwnerColumn());
+	else if(obj_type==OBJ_VIEW)
+	{
+		View *view=dynamic_cast<View *>(object);
+
+		count=view->getReferenceCount();
+		for(i=0; i < count && !found; i++)
+			found=columns.contains(view->getReference(i).getColumn());
+	}
+
+	return(found);
+}
+
+void DatabaseModel::storeSpecialObjectsXML(QSet<BaseObject *> *tabs)
 {
 	unsigned count, i, type_id;
 	vector<BaseObject *>::iterator itr, itr_end;
@@ -1341,9 +1793,36 @@ void DatabaseModel::storeSpecialObjectsXML(void)
 	Reference ref;
 	ObjectType tab_obj_type[3]={ OBJ_CONSTRAINT, OBJ_TRIGGER, OBJ_INDEX };
 	bool found=false;
+	QSet<BaseObject *> rel_cols;
+	QSet<BaseObject *>::iterator itr_tab;
+	vector<Sequence *> special_seqs;
 
 	try
 	{
+		/* When the tables set is specified only the special objects that references the
+		 columns added by relationship on that tables are stored */
+		if(tabs)
+		{
+			for(itr_tab=tabs->begin(); itr_tab!=tabs->end(); itr_tab++)
+			{
+				table=dynamic_cast<Table *>(*itr_tab);
+
+				if(table)
+				{
+					count=table->getColumnCount();
+					for(i=0; i < count; i++)
+					{
+						if(table->getColumn(i)->isAddedByRelationship())
+							rel_cols.insert(table->getColumn(i));
+					}
+				}
+			}
+
+			//There is nothing to be stored if the tables doesn't have columns added by relationship
+			if(rel_cols.empty())
+				return;
+		}
+
 		itr=tables.begin();
 		itr_end=tables.end();
 
@@ -1373,43 +1852,35 @@ void DatabaseModel::storeSpecialObjectsXML(void)
 				 relationship (created manually by the user) */
 						found=(!constr->isAddedByRelationship() &&
 									 constr->isReferRelationshipAddedColumn() &&
-									 constr->getConstraintType()!=ConstraintType::primary_key);
+									 constr->getConstraintType()!=ConstraintType::primary_key &&
+									 (!tabs || isReferencingColumns(constr, rel_cols)));
 
-						//When found some special object, stores is xml definition
-						if(found)
-							xml_special_objs[constr->getObjectId()]=constr->getCodeDefinition(SchemaParser::XML_DEFINITION, true);
 					}
 					else if(tab_obj_type[type_id]==OBJ_TRIGGER)
 					{
 						trigger=dynamic_cast<Trigger *>(tab_obj);
-						found=trigger->isReferRelationshipAddedColumn();
-
-						if(found)
-							xml_special_objs[trigger->getObjectId()]=trigger->getCodeDefinition(SchemaParser::XML_DEFINITION);
+						found=(trigger->isReferRelationshipAddedColumn() &&
+									 (!tabs || isReferencingColumns(trigger, rel_cols)));
 					}
 					else
 					{
 						index=dynamic_cast<Index *>(tab_obj);
-						found=index->isReferRelationshipAddedColumn();
-
-						if(found)
-							xml_special_objs[index->getObjectId()]=index->getCodeDefinition(SchemaParser::XML_DEFINITION);
+						found=(index->isReferRelationshipAddedColumn() &&
+									 (!tabs || isReferencingColumns(index, rel_cols)));
 					}
 
+					//When found the special object is detached from the parent table
 					if(found)
 					{
-						//When found the special object must be removed from the parent table
-						table->removeObject(tab_obj->getName(), tab_obj->getObjectType());
-
-						//Removes the permission from the table object
-						removePermissions(tab_obj);
-
+						storeSpecialObject(tab_obj);
 						i--; count--;
 					}
 				}
 			}
 		}
 
+		/* The sequences are detached only after the scan since the detachment
+		 removes them from the sequences list */
 		itr=sequences.begin();
 		itr_end=sequences.end();
 
@@ -1418,12 +1889,15 @@ void DatabaseModel::storeSpecialObjectsXML(void)
 			sequence=dynamic_cast<Sequence *>(*itr);
 			itr++;
 
-			if(sequence->isReferRelationshipAddedColumn())
-			{
-				xml_special_objs[sequence->getObjectId()]=sequence->getCodeDefinition(SchemaParser::XML_DEFINITION);
-				removeSequence(sequence);
-				delete(sequence);
-			}
+			if(sequence->isReferRelationshipAddedColumn() &&
+				 (!tabs || isReferencingColumns(sequence, rel_cols)))
+				special_seqs.push_back(sequence);
+		}
+
+		while(!special_seqs.empty())
+		{
+			storeSpecialObject(special_seqs.back());
+			special_seqs.pop_back();
 		}
 
 		itr=views.begin();
@@ -1434,9 +1908,10 @@ void DatabaseModel::storeSpecialObjectsXML(void)
 			view=dynamic_cast<View *>(*itr);
 			itr++;
 
-			if(view->isReferRelationshipAddedColumn())
+			if(view->isReferRelationshipAddedColumn() &&
+				 (!tabs || isReferencingColumns(view, rel_cols)))
 			{
-				xml_special_objs[view->getObjectId()]=view->getCodeDefinition(SchemaParser::XML_DEFINITION);
+				special_objs[view->getObjectId()].xml_def=view->getCodeDefinition(SchemaParser::XML_DEFINITION);
 
 				/* Relationships linking the view and the referenced tables are considered as
 			 special objects in this case only to be recreated more easely latter */
@@ -1455,7 +1930,7 @@ void DatabaseModel::storeSpecialObjectsXML(void)
 
 						if(rel)
 						{
-							xml_special_objs[rel->getObjectId()]=rel->getCodeDefinition();
+							special_objs[rel->getObjectId()].xml_def=rel->getCodeDefinition();
 							removeRelationship(rel);
 							delete(rel);
 						}
@@ -1473,19 +1948,241 @@ void DatabaseModel::storeSpecialObjectsXML(void)
 	}
 }
 
-void DatabaseModel::createSpecialObject(const QString &xml_def, unsigned obj_id)
+void DatabaseModel::storeSpecialObject(BaseObject *object)
 {
+	SpecialObjectSnapshot snapshot;
 	ObjectType obj_type;
-	BaseObject *object=NULL;
+	Column *column=NULL;
+	unsigned count, i;
 
 	try
 	{
-		//Restart the XML parser to read the passed xml buffer
-		XMLParser::restartParser();
-		XMLParser::loadXMLBuffer(xml_def);
-
+		if(!object)
+			throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		obj_type=object->getObjectType();
+		snapshot.object=object;
+
+		if(obj_type==OBJ_CONSTRAINT)
+		{
+			Constraint *constr=dynamic_cast<Constraint *>(object);
+
+			count=constr->getColumnCount(Constraint::SOURCE_COLS);
+			for(i=0; i < count; i++)
+				snapshot.columns.push_back(constr->getColumn(i, Constraint::SOURCE_COLS)->getName());
+
+			count=constr->getColumnCount(Constraint::REFERENCED_COLS);
+			for(i=0; i < count; i++)
+				snapshot.ref_columns.push_back(constr->getColumn(i, Constraint::REFERENCED_COLS)->getName());
+		}
+		else if(obj_type==OBJ_TRIGGER)
+		{
+			Trigger *trigger=dynamic_cast<Trigger *>(object);
+
+			count=trigger->getColumnCount();
+			for(i=0; i < count; i++)
+				snapshot.columns.push_back(trigger->getColumn(i)->getName());
+		}
+		else if(obj_type==OBJ_INDEX)
+		{
+			Index *index=dynamic_cast<Index *>(object);
+
+			count=index->getElementCount();
+			for(i=0; i < count; i++)
+			{
+				snapshot.elements.push_back(index->getElement(i));
+				column=snapshot.elements.back().getColumn();
+				snapshot.columns.push_back(column ? column->getName() : QString());
+			}
+		}
+		else if(obj_type==OBJ_SEQUENCE)
+		{
+			column=dynamic_cast<Sequence *>(object)->getOwnerColumn();
+			snapshot.table=dynamic_cast<Table *>(column->getParentTable());
+			snapshot.columns.push_back(column->getName());
+		}
+		else
+			throw Exception(ERR_OPR_OBJ_INV_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		//Detaches the object from the model
+		if(obj_type==OBJ_SEQUENCE)
+			removeSequence(dynamic_cast<Sequence *>(object));
+		else
+		{
+			snapshot.table=dynamic_cast<Table *>(dynamic_cast<TableObject *>(object)->getParentTable());
+			snapshot.table->removeObject(object->getName(), obj_type);
+
+			//Removes the permission from the table object
+			removePermissions(dynamic_cast<TableObject *>(object));
+		}
+
+		special_objs[object->getObjectId()]=snapshot;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+	}
+}
+
+void DatabaseModel::createSpecialObject(SpecialObjectSnapshot &snapshot, unsigned obj_id)
+{
+	BaseObject *object=snapshot.object;
+	ObjectType obj_type;
+	Table *ref_table=NULL;
+	Column *column=NULL;
+	unsigned i;
+
+	//Objects stored as XML are created by the parser
+	if(!object)
+	{
+		createSpecialObject(snapshot.xml_def, obj_id);
+		return;
+	}
+
+	try
+	{
+		obj_type=object->getObjectType();
+
+		//Raises an error if the table that owned the object was removed from the model meanwhile
+		if(!snapshot.table || getObjectIndex(snapshot.table) < 0)
+			throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		/* Rebinds the object to the current columns. As well the xml definition, the columns
+		 are searched by their names and, when not found, by their old names */
+		if(obj_type==OBJ_CONSTRAINT)
+		{
+			Constraint *constr=dynamic_cast<Constraint *>(object);
+
+			constr->removeColumns();
+			for(i=0; i < snapshot.columns.size(); i++)
+			{
+				column=snapshot.table->getColumn(snapshot.columns[i]);
+				if(!column) column=snapshot.table->getColumn(snapshot.columns[i], true);
+				constr->addColumn(column, Constraint::SOURCE_COLS);
+			}
+
+			ref_table=dynamic_cast<Table *>(constr->getReferencedTable());
+			for(i=0; ref_table && i < snapshot.ref_columns.size(); i++)
+			{
+				column=ref_table->getColumn(snapshot.ref_columns[i]);
+				if(!column) column=ref_table->getColumn(snapshot.ref_columns[i], true);
+				constr->addColumn(column, Constraint::REFERENCED_COLS);
+			}
+		}
+		else if(obj_type==OBJ_TRIGGER)
+		{
+			Trigger *trigger=dynamic_cast<Trigger *>(object);
+
+			//The trigger must belong to the table so its columns can be assigned
+			trigger->setParentTable(snapshot.table);
+			trigger->removeColumns();
+
+			for(i=0; i < snapshot.columns.size(); i++)
+			{
+				column=snapshot.table->getColumn(snapshot.columns[i]);
+				if(!column) column=snapshot.table->getColumn(snapshot.columns[i], true);
+				trigger->addColumn(column);
+			}
+		}
+		else if(obj_type==OBJ_INDEX)
+		{
+			Index *index=dynamic_cast<Index *>(object);
+			IndexElement *elem=NULL;
+
+			index->removeElements();
+			for(i=0; i < snapshot.elements.size(); i++)
+			{
+				elem=&snapshot.elements[i];
+
+				if(snapshot.columns[i].isEmpty())
+					index->addElement(elem->getExpression(), elem->getOperatorClass(),
+														elem->getSortAttribute(IndexElement::ASC_ORDER),
+														elem->getSortAttribute(IndexElement::NULLS_FIRST));
+				else
+				{
+					column=snapshot.table->getColumn(snapshot.columns[i]);
+					if(!column) column=snapshot.table->getColumn(snapshot.columns[i], true);
+					index->addElement(column, elem->getOperatorClass(),
+														elem->getSortAttribute(IndexElement::ASC_ORDER),
+														elem->getSortAttribute(IndexElement::NULLS_FIRST));
+				}
+			}
+		}
+		else if(obj_type==OBJ_SEQUENCE)
+			dynamic_cast<Sequence *>(object)->setOwnerColumn(snapshot.table, snapshot.columns[0]);
+
+		//Reinserts the object on the model
+		if(obj_type==OBJ_SEQUENCE)
+			addSequence(dynamic_cast<Sequence *>(object));
+		else
+		{
+			snapshot.table->addObject(object);
+			snapshot.table->setModified(true);
+		}
+
+		//The object is owned by the model again
+		snapshot.object=NULL;
+
+		/* Restores the object id since it can be changed by the rebinding
+		 (e.g. sequences owned by columns created after them) */
+		object->object_id=obj_id;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+	}
+}
+
+bool DatabaseModel::createSpecialObjects(void)
+{
+	map<unsigned, SpecialObjectSnapshot>::iterator itr, itr_end;
+	bool xml_used=false;
+
+	itr=special_objs.begin();
+	itr_end=special_objs.end();
+
+	while(itr!=itr_end)
+	{
+		xml_used=(xml_used || !itr->second.object);
+		createSpecialObject(itr->second, itr->first);
+		itr++;
+	}
+
+	special_objs.clear();
+	return(xml_used);
+}
+
+void DatabaseModel::clearSpecialObjects(void)
+{
+	map<unsigned, SpecialObjectSnapshot>::iterator itr, itr_end;
+
+	itr=special_objs.begin();
+	itr_end=special_objs.end();
+
+	//Destroys the objects that could not be reinserted on the model
+	while(itr!=itr_end)
+	{
+		if(itr->second.object)
+			delete(itr->second.object);
+		itr++;
+	}
+
+	special_objs.clear();
+}
+
+void DatabaseModel::createSpecialObject(const QString &xml_def, unsigned obj_id)
+{
+	ObjectType obj_type;
+	BaseObject *object=NULL;
+
+	try
+	{
+		//Restart the XML parser to read the passed xml buffer
+		xmlparser.restartParser();
+		xmlparser.loadXMLBuffer(xml_def);
+
 		//Identifies the object type through the start element on xml buffer
-		obj_type=getObjectType(XMLParser::getElementName());
+		obj_type=getObjectType(xmlparser.getElementName());
 
 		if(obj_type==OBJ_SEQUENCE)
 			object=createSequence(true);
@@ -2383,7 +3080,12 @@ int DatabaseModel::getPermissionIndex(Permission *perm)
 BaseObject *DatabaseModel::getObject(const QString &name, ObjectType obj_type)
 {
 	int idx;
-	return(getObject(name, obj_type, idx));
+
+	//Objects stored on the name indexes are returned without calculating their indexes on the lists
+	if(isNameIndexed(obj_type))
+		return(getIndexedObject(name, obj_type));
+	else
+		return(getObject(name, obj_type, idx));
 }
 
 int DatabaseModel::getObjectIndex(const QString &name, ObjectType obj_type)
@@ -2427,19 +3129,31 @@ int DatabaseModel::getObjectIndex(BaseObject *object)
 	}
 }
 
-void DatabaseModel::loadModel(const QString &filename)
+XMLParser *DatabaseModel::getXMLParser(void)
+{
+	return(&xmlparser);
+}
+
+void DatabaseModel::loadModel(const QString &filename, bool trust_checksum)
+{
+	__loadModel(filename, trust_checksum, false);
+}
+
+void DatabaseModel::loadModelStream(const QString &filename, bool trust_checksum)
+{
+	__loadModel(filename, trust_checksum, true);
+}
+
+void DatabaseModel::__loadModel(const QString &filename, bool trust_checksum, bool use_stream)
 {
 	if(filename!="")
 	{
 		QString dtd_file, str_aux, elem_name;
 		ObjectType obj_type;
 		map<QString, QString> attribs;
-		BaseObject *object=NULL;
-		deque<const xmlNode *> incomplt_objs;
-		bool reeval_objs=false, protected_model=false;
-		const xmlNode *elem_aux=NULL;
-		deque<Exception> errors;
-		map<unsigned, QString>::iterator itr, itr_end;
+		deque<QString> incomplt_defs;
+		deque<const xmlNode *> incomplt_elems;
+		bool protected_model=false, has_elem=false;
 
 		//Configuring the path to the base path for objects DTD
 		dtd_file=GlobalAttributes::SCHEMAS_ROOT_DIR +
@@ -2452,182 +3166,134 @@ void DatabaseModel::loadModel(const QString &filename)
 		try
 		{
 			loading_model=true;
-			XMLParser::restartParser();
+			xmlparser.restartParser();
 
 			//Loads the root DTD
-			XMLParser::setDTDFile(dtd_file + GlobalAttributes::ROOT_DTD +
+			xmlparser.setDTDFile(dtd_file + GlobalAttributes::ROOT_DTD +
 														GlobalAttributes::OBJECT_DTD_EXT,
 														GlobalAttributes::ROOT_DTD);
+			xmlparser.setTrustChecksum(trust_checksum);
 
-			//Loads the file validating it against the root DTD
-			XMLParser::loadXMLFile(filename);
+			/* Loads the file validating it against the root DTD. In stream mode only the root element
+			 is read and the parser is positioned at it */
+			if(use_stream)
+				xmlparser.openXMLStream(filename);
+			else
+				xmlparser.loadXMLFile(filename);
 
 			//Gets the basic model information
-			XMLParser::getElementAttributes(attribs);
+			xmlparser.getElementAttributes(attribs);
 
 			this->author=attribs[ParsersAttributes::MODEL_AUTHOR];
 			protected_model=(attribs[ParsersAttributes::PROTECTED]==ParsersAttributes::_TRUE_);
 
-			if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+			if(use_stream)
+				has_elem=xmlparser.readNextStreamElement();
+			else
+				has_elem=xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+
+			while(has_elem)
 			{
-				do
+				//The stream only returns elements while the document tree also contains text and comment nodes
+				if(use_stream || xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+					elem_name=xmlparser.getElementName();
+					obj_type=getObjectType(elem_name);
+
+					/* The incomplete objects are recreated before the first element that is not a function, schema,
+						 tablespace, language, type or table */
+					if((incomplt_defs.size() > 0 || incomplt_elems.size() > 0) &&
+						 obj_type!=OBJ_FUNCTION && obj_type!=OBJ_SCHEMA &&
+						 obj_type!=OBJ_TABLESPACE && obj_type!=OBJ_LANGUAGE &&
+						 obj_type!=OBJ_TYPE && obj_type!=OBJ_TABLE)
 					{
-						elem_name=XMLParser::getElementName();
+						if(use_stream)
+							loadDeferredObjects(incomplt_defs);
+						else
+							loadDeferredObjects(incomplt_elems);
+					}
 
-						/* When the current element is a permission, indicates that the parser created all the
-				 other objects. Thus, if there is no incomplete objects that need to be recreated
-				 the permissions will be loaded */
-						if(elem_name==ParsersAttributes::PERMISSION && incomplt_objs.size()==0)
+					if(elem_name==ParsersAttributes::PERMISSION)
+					{
+						/* Recreates the special objects before load the permissions. The parser is moved back to the permission
+						 only when some object was created from its xml definition (replacing the parser's document) */
+						if(!special_objs.empty() && createSpecialObjects())
 						{
-							//Recreates the special objects before load the permissions
-							if(!xml_special_objs.empty())
+							if(use_stream)
+								xmlparser.accessStreamElement();
+							else
 							{
-								//Makes a backup of the main buffer of the xml parser that contains all the model file definition
-								str_aux=XMLParser::getXMLBuffer();
-
-								itr=xml_special_objs.begin();
-								itr_end=xml_special_objs.end();
-
-								while(itr!=itr_end)
-								{
-									createSpecialObject(itr->second, itr->first);
-									itr++;
-								}
-
-								xml_special_objs.clear();
-
-
-								//Reload the main buffer
-								XMLParser::restartParser();
-								XMLParser::loadXMLBuffer(str_aux);
-								XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
+								xmlparser.restartParser();
+								xmlparser.loadXMLFile(filename);
+								xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
 
 								//Moves the parser to the first permission on the buffer
-								while(XMLParser::getElementName()!=ParsersAttributes::PERMISSION &&
-											XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+								while(xmlparser.getElementName()!=ParsersAttributes::PERMISSION &&
+											xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 							}
-
-							addPermission(createPermission());
 						}
-						else
-						{
-							//Indentifies the object type to be load according to the current element on the parser
-							obj_type=getObjectType(elem_name);
-
-							/* This block makes the object re-evaluation, this means, read a code snippet again where,
-					after raising an error, an object was referecend before its creation.
-
-					Conditions for object re evaluation:
-					* the 'reeval_objs' is not set
-					* the incomplete objects list is not empty
-					* the object type is not a function, schema, tablespace, language, type or table. */
-							if(!reeval_objs && incomplt_objs.size() > 0 &&
-								 obj_type!=OBJ_FUNCTION && obj_type!=OBJ_SCHEMA &&
-								 obj_type!=OBJ_TABLESPACE && obj_type!=OBJ_LANGUAGE &&
-								 obj_type!=OBJ_TYPE && obj_type!=OBJ_TABLE)
-							{
-								XMLParser::accessElement(XMLParser::PREVIOUS_ELEMENT);
-								elem_aux=XMLParser::getCurrentElement();
-								reeval_objs=true;
-
-								//Restore the parser at the position of the incomplet object
-								XMLParser::restorePosition(incomplt_objs.front());
-
-								//Gets the incomplete object type
-								obj_type=getObjectType(XMLParser::getElementName());
-							}
 
-							if(obj_type==OBJ_DATABASE)
-							{
-								XMLParser::getElementAttributes(attribs);
-								encoding=attribs[ParsersAttributes::ENCODING];
-								template_db=attribs[ParsersAttributes::TEMPLATE_DB];
-								localizations[0]=attribs[ParsersAttributes::LC_CTYPE_DB];
-								localizations[1]=attribs[ParsersAttributes::LC_COLLATE_DB];
-
-								if(!attribs[ParsersAttributes::CONN_LIMIT].isEmpty())
-									conn_limit=attribs[ParsersAttributes::CONN_LIMIT].toInt();
-
-								setBasicAttributes(this);
-							}
-							else
-							{
-								try
-								{
-									//Saves the current position of the parser before create any object
-									XMLParser::savePosition();
-
-									object=createObject(obj_type);
+						addPermission(createPermission());
+					}
+					else if(obj_type==OBJ_DATABASE)
+					{
+						xmlparser.getElementAttributes(attribs);
+						encoding=attribs[ParsersAttributes::ENCODING];
+						template_db=attribs[ParsersAttributes::TEMPLATE_DB];
+						localizations[0]=attribs[ParsersAttributes::LC_CTYPE_DB];
+						localizations[1]=attribs[ParsersAttributes::LC_COLLATE_DB];
 
-									if(object)
-									{
-										if(!dynamic_cast<TableObject *>(object) &&
-											 obj_type!=OBJ_RELATIONSHIP && obj_type!=BASE_RELATIONSHIP)
-										{
-											addObject(object);
-										}
-
-										if(!signalsBlocked())
-										{
-											emit s_objectLoaded(XMLParser::getCurrentBufferLine()/XMLParser::getBufferLineCount(),
-																					trUtf8("Loading object: %1 (%2)")
-																					.arg(QString::fromUtf8(object->getName()))
-																					.arg(object->getTypeName()),
-																					obj_type);
-										}
-									}
+						if(!attribs[ParsersAttributes::CONN_LIMIT].isEmpty())
+							conn_limit=attribs[ParsersAttributes::CONN_LIMIT].toInt();
 
-									XMLParser::restorePosition();
-								}
-								catch(Exception &e)
-								{
-									if(!reeval_objs &&
-										 (((e.getErrorType()==ERR_REF_OBJ_INEXISTS_MODEL && obj_type==OBJ_TABLE)) ||
-											(((e.getErrorType()==ERR_ASG_OBJ_INV_DEFINITION ||
-												 e.getErrorType()==ERR_REF_OBJ_INEXISTS_MODEL ||
-												 e.getErrorType()==ERR_ASG_INV_TYPE_OBJECT) &&
-												(obj_type==OBJ_LANGUAGE || obj_type==OBJ_FUNCTION || obj_type==OBJ_TYPE || obj_type==OBJ_OPERATOR)))))
-									{
-										XMLParser::restorePosition();
-										incomplt_objs.push_back(XMLParser::getCurrentElement());
-										errors.push_back(e);
-									}
-									else
-									{
-										QString info_adicional=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename()).arg(XMLParser::getCurrentElement()->line);
-										throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, info_adicional);
-									}
-								}
-							}
+						setBasicAttributes(this);
+					}
+					else
+					{
+						try
+						{
+							loadObject(obj_type, getLoadingProgress(use_stream));
 						}
-
-						/* If the current process is re-evaluate incomplete objects, removes the object
-				 in the front of the incomplete objects because at this point it was
-				 successfully recreated */
-						if(reeval_objs && incomplt_objs.size() > 0)
+						catch(Exception &e)
 						{
-							incomplt_objs.pop_front();
-							errors.pop_front();
+							/* The objects that reference others not yet created are deferred. In stream mode the element
+								 is deallocated when the next one is read, so their xml code is stored instead of the element */
+							if((e.getErrorType()==ERR_REF_OBJ_INEXISTS_MODEL && obj_type==OBJ_TABLE) ||
+								 ((e.getErrorType()==ERR_ASG_OBJ_INV_DEFINITION ||
+									 e.getErrorType()==ERR_REF_OBJ_INEXISTS_MODEL ||
+									 e.getErrorType()==ERR_ASG_INV_TYPE_OBJECT) &&
+									(obj_type==OBJ_LANGUAGE || obj_type==OBJ_FUNCTION || obj_type==OBJ_TYPE || obj_type==OBJ_OPERATOR)))
+							{
+								xmlparser.restorePosition();
 
-							//If already exists incomplete objects, the parser will try to recreated the next incomplete object
-							if(incomplt_objs.size() > 0)
-								XMLParser::restorePosition(incomplt_objs.front());
+								if(use_stream)
+									incomplt_defs.push_back(xmlparser.getCurrentElementXML());
+								else
+									incomplt_elems.push_back(xmlparser.getCurrentElement());
+							}
 							else
 							{
-								reeval_objs=false;
-								XMLParser::restorePosition(elem_aux);
+								QString info_adicional=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename()).arg(xmlparser.getCurrentElement()->line);
+								throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, info_adicional);
 							}
 						}
 					}
 				}
-				while((!reeval_objs && XMLParser::accessElement(XMLParser::NEXT_ELEMENT)) ||
-							(reeval_objs));
+
+				if(use_stream)
+					has_elem=xmlparser.readNextStreamElement();
+				else
+					has_elem=xmlparser.accessElement(XMLParser::NEXT_ELEMENT);
 			}
 
-			if(errors.size() > 0)
-				throw Exception(errors[0].getErrorMessage(),errors[0].getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__);
+			//Objects still incomplete at the end of the file have a last chance to be recreated
+			if(incomplt_defs.size() > 0)
+				loadDeferredObjects(incomplt_defs);
+			else if(incomplt_elems.size() > 0)
+				loadDeferredObjects(incomplt_elems);
+
+			if(use_stream)
+				xmlparser.closeXMLStream();
 
 			this->BaseObject::setProtected(protected_model);
 			loading_model=false;
@@ -2637,10 +3303,14 @@ void DatabaseModel::loadModel(const QString &filename)
 		{
 			QString extra_info;
 			loading_model=false;
-			destroyObjects();
 
-			if(XMLParser::getCurrentElement())
-				extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename()).arg(XMLParser::getCurrentElement()->line);
+			if(xmlparser.getCurrentElement())
+				extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename()).arg(xmlparser.getCurrentElement()->line);
+
+			if(use_stream)
+				xmlparser.closeXMLStream();
+
+			destroyObjects();
 
 			if(e.getErrorType()>=ERR_INVALID_SYNTAX)
 			{
@@ -2653,6 +3323,73 @@ void DatabaseModel::loadModel(const QString &filename)
 	}
 }
 
+int DatabaseModel::getLoadingProgress(bool use_stream)
+{
+	if(use_stream)
+		return(xmlparser.getStreamProgress());
+	else
+		return(xmlparser.getCurrentBufferLine()/xmlparser.getBufferLineCount());
+}
+
+void DatabaseModel::loadObject(ObjectType obj_type, int progress)
+{
+	BaseObject *object=NULL;
+
+	//Saves the current position of the parser before create any object
+	xmlparser.savePosition();
+
+	object=createObject(obj_type);
+
+	if(object)
+	{
+		if(!dynamic_cast<TableObject *>(object) &&
+			 obj_type!=OBJ_RELATIONSHIP && obj_type!=BASE_RELATIONSHIP)
+		{
+			addObject(object);
+		}
+
+		if(!signalsBlocked())
+		{
+			emit s_objectLoaded(progress,
+													trUtf8("Loading object: %1 (%2)")
+													.arg(QString::fromUtf8(object->getName()))
+													.arg(object->getTypeName()),
+													obj_type);
+		}
+	}
+
+	xmlparser.restorePosition();
+}
+
+void DatabaseModel::loadDeferredObjects(deque<QString> &xml_defs)
+{
+	while(!xml_defs.empty())
+	{
+		xmlparser.restartParser();
+		xmlparser.loadXMLBuffer(xml_defs.front());
+		loadObject(getObjectType(xmlparser.getElementName()), getLoadingProgress(true));
+		xml_defs.pop_front();
+	}
+
+	//Moves the parser back to the element read from the stream
+	xmlparser.accessStreamElement();
+}
+
+void DatabaseModel::loadDeferredObjects(deque<const xmlNode *> &elems)
+{
+	const xmlNode *curr_elem=xmlparser.getCurrentElement();
+
+	while(!elems.empty())
+	{
+		xmlparser.restorePosition(elems.front());
+		loadObject(getObjectType(xmlparser.getElementName()), getLoadingProgress(false));
+		elems.pop_front();
+	}
+
+	//Moves the parser back to the element being read from the document
+	xmlparser.restorePosition(curr_elem);
+}
+
 ObjectType DatabaseModel::getObjectType(const QString &type_name)
 {
 	ObjectType obj_type=BASE_OBJECT;
@@ -2736,7 +3473,7 @@ void DatabaseModel::setBasicAttributes(BaseObject *object)
 	if(!object)
 		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	XMLParser::getElementAttributes(attribs);
+	xmlparser.getElementAttributes(attribs);
 
 	obj_type_aux=object->getObjectType();
 	if(obj_type_aux!=OBJ_CAST)
@@ -2744,29 +3481,29 @@ void DatabaseModel::setBasicAttributes(BaseObject *object)
 
 	protected_obj=attribs[ParsersAttributes::PROTECTED]==ParsersAttributes::_TRUE_;
 
-	XMLParser::savePosition();
+	xmlparser.savePosition();
 
-	if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+	if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 	{
 		do
 		{
-			if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+			if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 			{
-				elem_name=XMLParser::getElementName();
+				elem_name=xmlparser.getElementName();
 
 				//Defines the object's comment
 				if(elem_name==ParsersAttributes::COMMENT)
 				{
-					XMLParser::savePosition();
-					XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
-					object->setComment(XMLParser::getElementContent());
-					XMLParser::restorePosition();
+					xmlparser.savePosition();
+					xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+					object->setComment(xmlparser.getElementContent());
+					xmlparser.restorePosition();
 				}
 				//Defines the object's schema
 				else if(elem_name==ParsersAttributes::SCHEMA)
 				{
 					obj_type=OBJ_SCHEMA;
-					XMLParser::getElementAttributes(attribs_aux);
+					xmlparser.getElementAttributes(attribs_aux);
 					schema=dynamic_cast<Schema *>(getObject(attribs_aux[ParsersAttributes::NAME], obj_type));
 					object->setSchema(schema);
 					has_error=(!schema && !attribs_aux[ParsersAttributes::NAME].isEmpty());
@@ -2775,7 +3512,7 @@ void DatabaseModel::setBasicAttributes(BaseObject *object)
 				else if(elem_name==ParsersAttributes::TABLESPACE)
 				{
 					obj_type=OBJ_TABLESPACE;
-					XMLParser::getElementAttributes(attribs_aux);
+					xmlparser.getElementAttributes(attribs_aux);
 					tabspc=getObject(attribs_aux[ParsersAttributes::NAME], obj_type);
 					object->setTablespace(tabspc);
 					has_error=(!tabspc && !attribs_aux[ParsersAttributes::NAME].isEmpty());
@@ -2784,7 +3521,7 @@ void DatabaseModel::setBasicAttributes(BaseObject *object)
 				else if(elem_name==ParsersAttributes::ROLE)
 				{
 					obj_type=OBJ_ROLE;
-					XMLParser::getElementAttributes(attribs_aux);
+					xmlparser.getElementAttributes(attribs_aux);
 					owner=getObject(attribs_aux[ParsersAttributes::NAME], obj_type);
 					object->setOwner(owner);
 					has_error=(!owner && !attribs_aux[ParsersAttributes::NAME].isEmpty());
@@ -2792,7 +3529,7 @@ void DatabaseModel::setBasicAttributes(BaseObject *object)
 				//Defines the object's position (only for graphical objects)
 				else if(elem_name==ParsersAttributes::POSITION)
 				{
-					XMLParser::getElementAttributes(attribs);
+					xmlparser.getElementAttributes(attribs);
 
 					if(elem_name==ParsersAttributes::POSITION &&
 						 (obj_type_aux!=OBJ_RELATIONSHIP &&
@@ -2806,10 +3543,10 @@ void DatabaseModel::setBasicAttributes(BaseObject *object)
 				}
 			}
 		}
-		while(!has_error && XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+		while(!has_error && xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 	}
 
-	XMLParser::restorePosition();
+	xmlparser.restorePosition();
 	object->setProtected(protected_obj);
 
 	if(has_error)
@@ -2860,7 +3597,7 @@ Role *DatabaseModel::createRole(void)
 		setBasicAttributes(role);
 
 		//Gets all the attributes values from the XML
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		role->setPassword(attribs[ParsersAttributes::PASSWORD]);
 		role->setValidity(attribs[ParsersAttributes::VALIDITY]);
@@ -2878,19 +3615,19 @@ Role *DatabaseModel::createRole(void)
 			role->setOption(op_vect[i], marked);
 		}
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem_name=XMLParser::getElementName();
+					elem_name=xmlparser.getElementName();
 
 					//Getting the member roles
 					if(elem_name==ParsersAttributes::ROLES)
 					{
 						//Gets the member roles attributes
-						XMLParser::getElementAttributes(attribs_aux);
+						xmlparser.getElementAttributes(attribs_aux);
 
 						//The member roles names are separated by comma, so it is needed to split them
 						list=attribs_aux[ParsersAttributes::NAMES].split(',');
@@ -2925,14 +3662,14 @@ Role *DatabaseModel::createRole(void)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(role) delete(role);
 
@@ -2951,14 +3688,14 @@ Tablespace *DatabaseModel::createTablespace(void)
 	{
 		tabspc=new Tablespace;
 		setBasicAttributes(tabspc);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 		tabspc->setDirectory(attribs[ParsersAttributes::DIRECTORY]);
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(tabspc) delete(tabspc);
 
@@ -2976,7 +3713,7 @@ Schema *DatabaseModel::createSchema(void)
 	try
 	{
 		schema=new Schema;
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 		setBasicAttributes(schema);
 		schema->setFillColor(QColor(attribs[ParsersAttributes::FILL_COLOR]));
 		schema->setRectVisible(attribs[ParsersAttributes::RECT_VISIBLE]==ParsersAttributes::_TRUE_);
@@ -2984,8 +3721,8 @@ Schema *DatabaseModel::createSchema(void)
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(schema) delete(schema);
 		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
@@ -3005,22 +3742,22 @@ Language *DatabaseModel::createLanguage(void)
 	try
 	{
 		lang=new Language;
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 		setBasicAttributes(lang);
 
 		lang->setTrusted(attribs[ParsersAttributes::TRUSTED]==ParsersAttributes::_TRUE_);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					obj_type=getObjectType(XMLParser::getElementName());
+					obj_type=getObjectType(xmlparser.getElementName());
 
 					if(obj_type==OBJ_FUNCTION)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 
 						//Gets the function reference type
 						ref_type=attribs[ParsersAttributes::REF_TYPE];
@@ -3057,15 +3794,15 @@ Language *DatabaseModel::createLanguage(void)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(lang) delete(lang);
 
@@ -3089,7 +3826,7 @@ Function *DatabaseModel::createFunction(void)
 	{
 		func=new Function;
 		setBasicAttributes(func);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		if(!attribs[ParsersAttributes::RETURNS_SETOF].isEmpty())
 			func->setReturnSetOf(attribs[ParsersAttributes::RETURNS_SETOF]==
@@ -3114,56 +3851,56 @@ Function *DatabaseModel::createFunction(void)
 		if(!attribs[ParsersAttributes::ROW_AMOUNT].isEmpty())
 			func->setRowAmount(attribs[ParsersAttributes::ROW_AMOUNT].toInt());
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 					obj_type=getObjectType(elem);
 
 					//Gets the function return type from the XML
 					if(elem==ParsersAttributes::RETURN_TYPE)
 					{
-						XMLParser::savePosition();
+						xmlparser.savePosition();
 
 						try
 						{
-							XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
+							xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
 
 							do
 							{
-								if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+								if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 								{
 									//when the element found is a TYPE indicates that the function return type is a single one
-									if(XMLParser::getElementName()==ParsersAttributes::TYPE)
+									if(xmlparser.getElementName()==ParsersAttributes::TYPE)
 									{
 										type=createPgSQLType();
 										func->setReturnType(type);
 									}
 									//when the element found is a PARAMETER indicates that the function return type is a table
-									else if(XMLParser::getElementName()==ParsersAttributes::PARAMETER)
+									else if(xmlparser.getElementName()==ParsersAttributes::PARAMETER)
 									{
 										param=createParameter();
 										func->addReturnedTableColumn(param.getName(), param.getType());
 									}
 								}
 							}
-							while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+							while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 
-							XMLParser::restorePosition();
+							xmlparser.restorePosition();
 						}
 						catch(Exception &e)
 						{
-							XMLParser::restorePosition();
+							xmlparser.restorePosition();
 							throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 						}
 					}
 					//Gets the function language
 					else if(obj_type==OBJ_LANGUAGE)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						object=getObject(attribs[ParsersAttributes::NAME], obj_type);
 
 						//Raises an error if the function doesn't exisits
@@ -3178,37 +3915,37 @@ Function *DatabaseModel::createFunction(void)
 						func->setLanguage(dynamic_cast<Language *>(object));
 					}
 					//Gets a function parameter
-					else if(XMLParser::getElementName()==ParsersAttributes::PARAMETER)
+					else if(xmlparser.getElementName()==ParsersAttributes::PARAMETER)
 					{
 						param=createParameter();
 						func->addParameter(param);
 					}
 					//Gets the function code definition
-					else if(XMLParser::getElementName()==ParsersAttributes::DEFINITION)
+					else if(xmlparser.getElementName()==ParsersAttributes::DEFINITION)
 					{
-						XMLParser::savePosition();
-						XMLParser::getElementAttributes(attribs_aux);
+						xmlparser.savePosition();
+						xmlparser.getElementAttributes(attribs_aux);
 
 						if(!attribs_aux[ParsersAttributes::LIBRARY].isEmpty())
 						{
 							func->setLibrary(attribs_aux[ParsersAttributes::LIBRARY]);
 							func->setSymbol(attribs_aux[ParsersAttributes::SYMBOL]);
 						}
-						else if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
-							func->setSourceCode(XMLParser::getElementContent());
+						else if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+							func->setSourceCode(xmlparser.getElementContent());
 
-						XMLParser::restorePosition();
+						xmlparser.restorePosition();
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(func)
 		{
@@ -3236,21 +3973,21 @@ Parameter DatabaseModel::createParameter(void)
 
 	try
 	{
-		XMLParser::savePosition();
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.savePosition();
+		xmlparser.getElementAttributes(attribs);
 
 		param.setName(attribs[ParsersAttributes::NAME]);
 		param.setIn(attribs[ParsersAttributes::PARAM_IN]==ParsersAttributes::_TRUE_);
 		param.setOut(attribs[ParsersAttributes::PARAM_OUT]==ParsersAttributes::_TRUE_);
 		param.setDefaultValue(attribs[ParsersAttributes::DEFAULT_VALUE]);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					if(elem==ParsersAttributes::TYPE)
 					{
@@ -3258,17 +3995,17 @@ Parameter DatabaseModel::createParameter(void)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
-		XMLParser::restorePosition();
+		xmlparser.restorePosition();
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
-		XMLParser::restorePosition();
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
+		xmlparser.restorePosition();
 		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
 	}
 
@@ -3281,12 +4018,11 @@ PgSQLType DatabaseModel::createPgSQLType(void)
 	unsigned length=1, dimension=0, type_idx=0;
 	int precision=-1;
 	QString name;
-	void *ptype=NULL;
 	bool with_timezone;
 	IntervalType interv_type;
 	SpatialType spatial_type;
 
-	XMLParser::getElementAttributes(attribs);
+	xmlparser.getElementAttributes(attribs);
 
 	if(!attribs[ParsersAttributes::LENGTH].isEmpty())
 		length=attribs[ParsersAttributes::LENGTH].toUInt();
@@ -3310,15 +4046,17 @@ PgSQLType DatabaseModel::createPgSQLType(void)
 	type_idx=PgSQLType::getBaseTypeIndex(name);
 	if(type_idx!=PgSQLType::null)
 	{
-		return(PgSQLType(name,length,dimension,precision,with_timezone,interv_type, spatial_type));
+		return(PgSQLType(type_idx,length,dimension,precision,with_timezone,interv_type, spatial_type));
 	}
 	else
 	{
+		//The user type is searched only between the types of this model
+		type_idx=PgSQLType::getUserTypeIndex(name,NULL,this);
+
 		//Raises an error if the referenced type name doesn't exists
-		if(PgSQLType::getUserTypeIndex(name,NULL,this) == BaseType::null)
+		if(type_idx == BaseType::null)
 			throw Exception(ERR_REF_INEXIST_USER_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		type_idx=PgSQLType::getUserTypeIndex(name, ptype);
 		return(PgSQLType(type_idx,length,dimension,precision,with_timezone,interv_type,spatial_type));
 	}
 }
@@ -3339,7 +4077,7 @@ Type *DatabaseModel::createType(void)
 	{
 		type=new Type;
 		setBasicAttributes(type);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		if(attribs[ParsersAttributes::CONFIGURATION]==ParsersAttributes::BASE_TYPE)
 		{
@@ -3384,18 +4122,18 @@ Type *DatabaseModel::createType(void)
 		else
 			type->setConfiguration(Type::ENUMERATION_TYPE);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					//Specific operations for ENUM type
 					if(elem==ParsersAttributes::ENUM_TYPE)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						enums=attribs[ParsersAttributes::VALUES].split(",");
 
 						count=enums.size();
@@ -3418,7 +4156,7 @@ Type *DatabaseModel::createType(void)
 					//Configuring the functions used by the type (only for BASE type)
 					else if(elem==ParsersAttributes::FUNCTION)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 
 						//Tries to get the function from the model
 						func=getObject(attribs[ParsersAttributes::SIGNATURE], OBJ_FUNCTION);
@@ -3440,14 +4178,14 @@ Type *DatabaseModel::createType(void)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(type)
 		{
@@ -3477,7 +4215,7 @@ Domain *DatabaseModel::createDomain(void)
 	{
 		domain=new Domain;
 		setBasicAttributes(domain);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		if(!attribs[ParsersAttributes::CONSTRAINT].isEmpty())
 			domain->setConstraintName(attribs[ParsersAttributes::CONSTRAINT]);
@@ -3488,13 +4226,13 @@ Domain *DatabaseModel::createDomain(void)
 		domain->setNotNull(attribs[ParsersAttributes::NOT_NULL]==
 				ParsersAttributes::_TRUE_);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					//If a type element is found it'll be extracted an type which the domain is applied
 					if(elem==ParsersAttributes::TYPE)
@@ -3503,21 +4241,21 @@ Domain *DatabaseModel::createDomain(void)
 					}
 					else if(elem==ParsersAttributes::EXPRESSION)
 					{
-						XMLParser::savePosition();
-						XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
-						domain->setExpression(XMLParser::getElementContent());
-						XMLParser::restorePosition();
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+						domain->setExpression(xmlparser.getElementContent());
+						xmlparser.restorePosition();
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(domain) delete(domain);
 
@@ -3540,7 +4278,7 @@ Cast *DatabaseModel::createCast(void)
 	{
 		cast=new Cast;
 		setBasicAttributes(cast);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		if(attribs[ParsersAttributes::CAST_TYPE]==ParsersAttributes::IMPLICIT)
 			cast->setCastType(Cast::IMPLICIT);
@@ -3549,13 +4287,13 @@ Cast *DatabaseModel::createCast(void)
 
 		cast->setInOut(attribs[ParsersAttributes::IO_CAST]==ParsersAttributes::_TRUE_);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					//Extract one argument type from the XML
 					if(elem==ParsersAttributes::TYPE)
@@ -3570,7 +4308,7 @@ Cast *DatabaseModel::createCast(void)
 					//Extracts the conversion function
 					else if(elem==ParsersAttributes::FUNCTION)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						func=getObject(attribs[ParsersAttributes::SIGNATURE], OBJ_FUNCTION);
 
 						//Raises an error if the function doesn't exists
@@ -3586,14 +4324,14 @@ Cast *DatabaseModel::createCast(void)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(cast) delete(cast);
 
@@ -3614,7 +4352,7 @@ Conversion *DatabaseModel::createConversion(void)
 	{
 		conv=new Conversion;
 		setBasicAttributes(conv);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		conv->setEncoding(Conversion::SRC_ENCODING,
 											EncodingType(attribs[ParsersAttributes::SRC_ENCODING]));
@@ -3622,17 +4360,17 @@ Conversion *DatabaseModel::createConversion(void)
 		conv->setEncoding(Conversion::DST_ENCODING,
 											EncodingType(attribs[ParsersAttributes::DST_ENCODING]));
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					if(elem==ParsersAttributes::FUNCTION)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						func=getObject(attribs[ParsersAttributes::SIGNATURE], OBJ_FUNCTION);
 
 						//Raises an error if the function doesn't exists
@@ -3648,14 +4386,14 @@ Conversion *DatabaseModel::createConversion(void)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(conv) delete(conv);
 
@@ -3680,7 +4418,7 @@ Operator *DatabaseModel::createOperator(void)
 	{
 		oper=new Operator;
 		setBasicAttributes(oper);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		oper->setMerges(attribs[ParsersAttributes::MERGES]==ParsersAttributes::_TRUE_);
 		oper->setHashes(attribs[ParsersAttributes::HASHES]==ParsersAttributes::_TRUE_);
@@ -3696,17 +4434,17 @@ Operator *DatabaseModel::createOperator(void)
 		oper_types[ParsersAttributes::SORT_OP]=Operator::OPER_SORT1;
 		oper_types[ParsersAttributes::SORT2_OP]=Operator::OPER_SORT2;
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					if(elem==objs_schemas[OBJ_OPERATOR])
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						oper_aux=getObject(attribs[ParsersAttributes::SIGNATURE], OBJ_OPERATOR);
 
 						//Raises an error if the auxiliary operator doesn't exists
@@ -3723,7 +4461,7 @@ Operator *DatabaseModel::createOperator(void)
 					}
 					else if(elem==ParsersAttributes::TYPE)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 
 						if(attribs[ParsersAttributes::REF_TYPE]!=ParsersAttributes::RIGHT_TYPE)
 							arg_type=Operator::LEFT_ARG;
@@ -3735,7 +4473,7 @@ Operator *DatabaseModel::createOperator(void)
 					}
 					else if(elem==ParsersAttributes::FUNCTION)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						func=getObject(attribs[ParsersAttributes::SIGNATURE], OBJ_FUNCTION);
 
 						//Raises an error if the function doesn't exists on the model
@@ -3752,14 +4490,14 @@ Operator *DatabaseModel::createOperator(void)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 		if(oper) delete(oper);
 
 		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
@@ -3784,7 +4522,7 @@ OperatorClass *DatabaseModel::createOperatorClass(void)
 	{
 		op_class=new OperatorClass;
 		setBasicAttributes(op_class);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		op_class->setIndexingType(IndexingType(attribs[ParsersAttributes::INDEX_TYPE]));
 		op_class->setDefault(attribs[ParsersAttributes::DEFAULT]==ParsersAttributes::_TRUE_);
@@ -3793,17 +4531,17 @@ OperatorClass *DatabaseModel::createOperatorClass(void)
 		elem_types[ParsersAttributes::OPERATOR]=OperatorClassElement::OPERATOR_ELEM;
 		elem_types[ParsersAttributes::STORAGE]=OperatorClassElement::STORAGE_ELEM;
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					if(elem==objs_schemas[OBJ_OPFAMILY])
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						object=getObject(attribs[ParsersAttributes::NAME], OBJ_OPFAMILY);
 
 						//Raises an error if the operator family doesn't exists
@@ -3819,21 +4557,21 @@ OperatorClass *DatabaseModel::createOperatorClass(void)
 					}
 					else if(elem==ParsersAttributes::TYPE)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						type=createPgSQLType();
 						op_class->setDataType(type);
 					}
 					else if(elem==ParsersAttributes::ELEMENT)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 
 						recheck=attribs[ParsersAttributes::RECHECK]==ParsersAttributes::_TRUE_;
 						stg_number=attribs[ParsersAttributes::STRATEGY_NUM].toUInt();
 						elem_type=elem_types[attribs[ParsersAttributes::TYPE]];
 
-						XMLParser::savePosition();
-						XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+						xmlparser.getElementAttributes(attribs);
 
 						if(elem_type==OperatorClassElement::STORAGE_ELEM)
 						{
@@ -3852,18 +4590,18 @@ OperatorClass *DatabaseModel::createOperatorClass(void)
 						}
 
 						op_class->addElement(class_elem);
-						XMLParser::restorePosition();
+						xmlparser.restorePosition();
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(op_class) delete(op_class);
 
@@ -3882,14 +4620,14 @@ OperatorFamily *DatabaseModel::createOperatorFamily(void)
 	{
 		op_family=new OperatorFamily;
 		setBasicAttributes(op_family);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 		op_family->setIndexingType(IndexingType(attribs[ParsersAttributes::INDEX_TYPE]));
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(op_family) delete(op_family);
 
@@ -3911,21 +4649,21 @@ Aggregate *DatabaseModel::createAggregate(void)
 	{
 		aggreg=new Aggregate;
 		setBasicAttributes(aggreg);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		aggreg->setInitialCondition(attribs[ParsersAttributes::INITIAL_COND]);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					if(elem==ParsersAttributes::TYPE)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						type=createPgSQLType();
 
 						if(attribs[ParsersAttributes::REF_TYPE]==ParsersAttributes::STATE_TYPE)
@@ -3935,7 +4673,7 @@ Aggregate *DatabaseModel::createAggregate(void)
 					}
 					else if(elem==ParsersAttributes::FUNCTION)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						func=getObject(attribs[ParsersAttributes::SIGNATURE], OBJ_FUNCTION);
 
 						//Raises an error if the function doesn't exists on the model
@@ -3956,14 +4694,14 @@ Aggregate *DatabaseModel::createAggregate(void)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(aggreg) delete(aggreg);
 
@@ -3984,18 +4722,18 @@ Table *DatabaseModel::createTable(void)
 	{
 		table=new Table;
 		setBasicAttributes(table);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		table->setWithOIDs(attribs[ParsersAttributes::OIDS]==ParsersAttributes::_TRUE_);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
-					XMLParser::savePosition();
+					elem=xmlparser.getElementName();
+					xmlparser.savePosition();
 					object=NULL;
 
 					if(elem==BaseObject::objs_schemas[OBJ_COLUMN])
@@ -4012,10 +4750,10 @@ Table *DatabaseModel::createTable(void)
 					if(object)
 						table->addObject(object);
 
-					XMLParser::restorePosition();
+					xmlparser.restorePosition();
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
 		table->setProtected(table->isProtected());
@@ -4023,10 +4761,10 @@ Table *DatabaseModel::createTable(void)
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
-		XMLParser::restorePosition();
+		xmlparser.restorePosition();
 
 		if(table) delete(table);
 
@@ -4047,17 +4785,17 @@ Column *DatabaseModel::createColumn(void)
 		column=new Column;
 		setBasicAttributes(column);
 
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 		column->setNotNull(attribs[ParsersAttributes::NOT_NULL]==ParsersAttributes::_TRUE_);
 		column->setDefaultValue(attribs[ParsersAttributes::DEFAULT_VALUE]);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					if(elem==ParsersAttributes::TYPE)
 					{
@@ -4065,14 +4803,14 @@ Column *DatabaseModel::createColumn(void)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(column) delete(column);
 
@@ -4100,7 +4838,7 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 
 	try
 	{
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		//If the constraint parent is allocated
 		if(parent_obj)
@@ -4197,26 +4935,26 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 			constr->setReferencedTable(ref_table);
 		}
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					if(elem==ParsersAttributes::EXPRESSION)
 					{
-						XMLParser::savePosition();
-						XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
 
-						constr->setCheckExpression(XMLParser::getElementContent());
+						constr->setCheckExpression(xmlparser.getElementContent());
 
-						XMLParser::restorePosition();
+						xmlparser.restorePosition();
 					}
 					else if(elem==ParsersAttributes::COLUMNS)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 
 						col_list=attribs[ParsersAttributes::NAMES].split(',');
 						count=col_list.count();
@@ -4256,7 +4994,7 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
 		if(ins_constr_table)
@@ -4272,8 +5010,8 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(constr) delete(constr);
 
@@ -4295,7 +5033,7 @@ Index *DatabaseModel::createIndex(Table *table)
 
 	try
 	{
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		if(!table)
 		{
@@ -4325,31 +5063,31 @@ Index *DatabaseModel::createIndex(Table *table)
 		index->setIndexingType(attribs[ParsersAttributes::INDEX_TYPE]);
 		index->setFillFactor(attribs[ParsersAttributes::FACTOR].toUInt());
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					if(elem==ParsersAttributes::INDEX_ELEMENT)
 					{
 						nulls_first=(attribs[ParsersAttributes::NULLS_FIRST]==ParsersAttributes::_TRUE_);
 						asc_order=(attribs[ParsersAttributes::ASC_ORDER]==ParsersAttributes::_TRUE_);
 
-						XMLParser::savePosition();
-						XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
 
 						do
 						{
-							elem=XMLParser::getElementName();
+							elem=xmlparser.getElementName();
 
-							if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+							if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 							{
 								if(elem==ParsersAttributes::OP_CLASS)
 								{
-									XMLParser::getElementAttributes(attribs);
+									xmlparser.getElementAttributes(attribs);
 									op_class=dynamic_cast<OperatorClass *>(getObject(attribs[ParsersAttributes::NAME], OBJ_OPCLASS));
 
 									//Raises an error if the operator class doesn't exists
@@ -4366,7 +5104,7 @@ Index *DatabaseModel::createIndex(Table *table)
 								}
 								else if(elem==ParsersAttributes::COLUMN)
 								{
-									XMLParser::getElementAttributes(attribs);
+									xmlparser.getElementAttributes(attribs);
 									column=table->getColumn(attribs[ParsersAttributes::NAME]);
 
 									if(!column)
@@ -4374,33 +5112,33 @@ Index *DatabaseModel::createIndex(Table *table)
 								}
 								else if(elem==ParsersAttributes::EXPRESSION)
 								{
-									XMLParser::savePosition();
-									XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
-									expr=XMLParser::getElementContent();
-									XMLParser::restorePosition();
+									xmlparser.savePosition();
+									xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+									expr=xmlparser.getElementContent();
+									xmlparser.restorePosition();
 								}
 							}
 						}
-						while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+						while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 
 						if(!expr.isEmpty())
 							index->addElement(expr, op_class, asc_order, nulls_first);
 						else
 							index->addElement(column, op_class, asc_order, nulls_first);
 
-						XMLParser::restorePosition();
+						xmlparser.restorePosition();
 					}
 					else if(elem==ParsersAttributes::CONDITION)
 					{
-						XMLParser::savePosition();
-						XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
-						str_aux=XMLParser::getElementContent();
-						XMLParser::restorePosition();
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+						str_aux=xmlparser.getElementContent();
+						xmlparser.restorePosition();
 						index->setConditionalExpression(str_aux);
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
 		if(inc_idx_table)
@@ -4412,8 +5150,8 @@ Index *DatabaseModel::createIndex(Table *table)
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(index) delete(index);
 
@@ -4436,26 +5174,26 @@ Rule *DatabaseModel::createRule(void)
 		rule=new Rule;
 		setBasicAttributes(rule);
 
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 		rule->setExecutionType(attribs[ParsersAttributes::EXEC_TYPE]);
 		rule->setEventType(attribs[ParsersAttributes::EVENT_TYPE]);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					if(elem==ParsersAttributes::COMMANDS ||
 						 elem==ParsersAttributes::CONDITION)
 					{
-						XMLParser::savePosition();
-						XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
 
-						str_aux=XMLParser::getElementContent();
-						XMLParser::restorePosition();
+						str_aux=xmlparser.getElementContent();
+						xmlparser.restorePosition();
 
 						if(elem==ParsersAttributes::COMMANDS)
 						{
@@ -4472,14 +5210,14 @@ Rule *DatabaseModel::createRule(void)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 		if(rule) delete(rule);
 
 		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
@@ -4501,7 +5239,7 @@ Trigger *DatabaseModel::createTrigger(Table *table)
 
 	try
 	{
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		if(!table && attribs[ParsersAttributes::TABLE].isEmpty())
 			throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
@@ -4561,17 +5299,17 @@ Trigger *DatabaseModel::createTrigger(Table *table)
 		ref_table=getObject(attribs[ParsersAttributes::REF_TABLE], OBJ_TABLE);
 		trigger->setReferecendTable(ref_table);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					if(elem==ParsersAttributes::FUNCTION)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						func=getObject(attribs[ParsersAttributes::SIGNATURE], OBJ_FUNCTION);
 
 						//Raises an error if the function doesn't exists
@@ -4590,15 +5328,15 @@ Trigger *DatabaseModel::createTrigger(Table *table)
 					}
 					else if(elem==ParsersAttributes::CONDITION)
 					{
-						XMLParser::savePosition();
-						XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
-						str_aux=XMLParser::getElementContent();
-						XMLParser::restorePosition();
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+						str_aux=xmlparser.getElementContent();
+						xmlparser.restorePosition();
 						trigger->setCondition(str_aux);
 					}
 					else if(elem==ParsersAttributes::COLUMNS)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 
 						list_aux=attribs[ParsersAttributes::NAMES].split(',');
 						count=list_aux.count();
@@ -4615,7 +5353,7 @@ Trigger *DatabaseModel::createTrigger(Table *table)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
 		if(inc_trig_table)
@@ -4627,8 +5365,8 @@ Trigger *DatabaseModel::createTrigger(Table *table)
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 		if(trigger) delete(trigger);
 
 		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
@@ -4651,7 +5389,7 @@ Sequence *DatabaseModel::createSequence(bool ignore_onwer)
 	{
 		sequence=new Sequence;
 		setBasicAttributes(sequence);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		sequence->setValues(attribs[ParsersAttributes::MIN_VALUE],
 				attribs[ParsersAttributes::MAX_VALUE],
@@ -4709,8 +5447,8 @@ Sequence *DatabaseModel::createSequence(bool ignore_onwer)
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 		if(sequence) delete(sequence);
 
 		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
@@ -4736,17 +5474,17 @@ View *DatabaseModel::createView(void)
 		view=new View;
 		setBasicAttributes(view);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					if(elem==ParsersAttributes::REFERENCE)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 
 						//If the table name is specified tries to create a reference to a table/column
 						if(!attribs[ParsersAttributes::TABLE].isEmpty())
@@ -4794,20 +5532,20 @@ View *DatabaseModel::createView(void)
 						}
 						else
 						{
-							XMLParser::savePosition();
+							xmlparser.savePosition();
 							str_aux=attribs[ParsersAttributes::ALIAS];
 
-							XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
-							XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
-							refs.push_back(Reference(XMLParser::getElementContent(),str_aux));
+							xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+							xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+							refs.push_back(Reference(xmlparser.getElementContent(),str_aux));
 
-							XMLParser::restorePosition();
+							xmlparser.restorePosition();
 						}
 					}
 					else if(elem==ParsersAttributes::EXPRESSION)
 					{
-						XMLParser::savePosition();
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.savePosition();
+						xmlparser.getElementAttributes(attribs);
 
 						if(attribs[ParsersAttributes::TYPE]==ParsersAttributes::SELECT_EXP)
 							type=Reference::SQL_REFER_SELECT;
@@ -4816,8 +5554,8 @@ View *DatabaseModel::createView(void)
 						else
 							type=Reference::SQL_REFER_WHERE;
 
-						XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
-						list_aux=XMLParser::getElementContent().split(',');
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+						list_aux=xmlparser.getElementContent().split(',');
 						count=list_aux.size();
 
 						for(i=0; i < count; i++)
@@ -4826,18 +5564,18 @@ View *DatabaseModel::createView(void)
 							view->addReference(refs[ref_idx],type);
 						}
 
-						XMLParser::restorePosition();
+						xmlparser.restorePosition();
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 		if(view) delete(view);
 
 		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
@@ -4856,7 +5594,7 @@ Textbox *DatabaseModel::createTextbox(void)
 		txtbox=new Textbox;
 		setBasicAttributes(txtbox);
 
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 
 		if(attribs[ParsersAttributes::ITALIC]==ParsersAttributes::_TRUE_)
 			txtbox->setTextAttribute(Textbox::ITALIC_TXT, true);
@@ -4873,8 +5611,8 @@ Textbox *DatabaseModel::createTextbox(void)
 	catch(Exception &e)
 	{
 		QString info_adicional;
-		info_adicional=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-									 .arg(XMLParser::getCurrentElement()->line);
+		info_adicional=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+									 .arg(xmlparser.getCurrentElement()->line);
 
 		if(txtbox) delete(txtbox);
 
@@ -4901,7 +5639,7 @@ BaseRelationship *DatabaseModel::createRelationship(void)
 
 	try
 	{
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.getElementAttributes(attribs);
 		protect=(attribs[ParsersAttributes::PROTECTED]==ParsersAttributes::_TRUE_);
 
 		if(attribs[ParsersAttributes::TYPE]!=ParsersAttributes::RELATION_TAB_VIEW &&
@@ -4992,58 +5730,58 @@ BaseRelationship *DatabaseModel::createRelationship(void)
 			base_rel=rel;
 		}
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					elem=XMLParser::getElementName();
+					elem=xmlparser.getElementName();
 
 					if(elem==ParsersAttributes::COLUMN && rel)
 					{
-						XMLParser::savePosition();
+						xmlparser.savePosition();
 						rel->addObject(createColumn());
-						XMLParser::restorePosition();
+						xmlparser.restorePosition();
 					}
 					else if(elem==ParsersAttributes::CONSTRAINT && rel)
 					{
-						XMLParser::savePosition();
+						xmlparser.savePosition();
 						rel->addObject(createConstraint(rel));
-						XMLParser::restorePosition();
+						xmlparser.restorePosition();
 					}
 					else if(elem==ParsersAttributes::LINE)
 					{
 						vector<QPointF> points;
-						XMLParser::savePosition();
-						XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
 
 						do
 						{
-							XMLParser::getElementAttributes(attribs);
+							xmlparser.getElementAttributes(attribs);
 							points.push_back(QPointF(attribs[ParsersAttributes::X_POS].toFloat(),
 															 attribs[ParsersAttributes::Y_POS].toFloat()));
 						}
-						while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+						while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 
 						base_rel->setPoints(points);
-						XMLParser::restorePosition();
+						xmlparser.restorePosition();
 					}
 					else if(elem==ParsersAttributes::LABEL)
 					{
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						str_aux=attribs[ParsersAttributes::REF_TYPE];
 
-						XMLParser::savePosition();
-						XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
-						XMLParser::getElementAttributes(attribs);
-						XMLParser::restorePosition();
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+						xmlparser.getElementAttributes(attribs);
+						xmlparser.restorePosition();
 					}
 					else if(elem==ParsersAttributes::SPECIAL_PK_COLS && rel)
 					{
 						QList<QString> col_list;
 
-						XMLParser::getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs);
 						col_list=attribs[ParsersAttributes::INDEXES].split(',');
 
 						while(!col_list.isEmpty())
@@ -5056,14 +5794,14 @@ BaseRelationship *DatabaseModel::createRelationship(void)
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 
 		if(base_rel && base_rel->getObjectType()==OBJ_RELATIONSHIP)
 			delete(base_rel);
@@ -5103,11 +5841,11 @@ Permission *DatabaseModel::createPermission(void)
 
 	try
 	{
-		XMLParser::getElementAttributes(priv_attribs);
+		xmlparser.getElementAttributes(priv_attribs);
 
-		XMLParser::savePosition();
-		XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
-		XMLParser::getElementAttributes(attribs);
+		xmlparser.savePosition();
+		xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+		xmlparser.getElementAttributes(attribs);
 
 		obj_type=getObjectType(attribs[ParsersAttributes::TYPE]);
 		obj_name=attribs[ParsersAttributes::NAME];
@@ -5139,9 +5877,9 @@ Permission *DatabaseModel::createPermission(void)
 
 		do
 		{
-			if(XMLParser::getElementName()==ParsersAttributes::ROLES)
+			if(xmlparser.getElementName()==ParsersAttributes::ROLES)
 			{
-				XMLParser::getElementAttributes(attribs);
+				xmlparser.getElementAttributes(attribs);
 
 				list=attribs[ParsersAttributes::NAMES].split(',');
 				len=list.size();
@@ -5166,9 +5904,9 @@ Permission *DatabaseModel::createPermission(void)
 					perm->addRole(role);
 				}
 			}
-			else if(XMLParser::getElementName()==ParsersAttributes::PRIVILEGES)
+			else if(xmlparser.getElementName()==ParsersAttributes::PRIVILEGES)
 			{
-				XMLParser::getElementAttributes(priv_attribs);
+				xmlparser.getElementAttributes(priv_attribs);
 
 				itr=priv_attribs.begin();
 				itr_end=priv_attribs.end();
@@ -5211,15 +5949,15 @@ Permission *DatabaseModel::createPermission(void)
 				}
 			}
 		}
-		while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+		while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 
-		XMLParser::restorePosition();
+		xmlparser.restorePosition();
 	}
 	catch(Exception &e)
 	{
 		QString extra_info;
-		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(XMLParser::getLoadedFilename())
-							 .arg(XMLParser::getCurrentElement()->line);
+		extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename())
+							 .arg(xmlparser.getCurrentElement()->line);
 		if(perm) delete(perm);
 
 		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
@@ -5283,10 +6021,13 @@ void DatabaseModel::validateRelationships(TableObject *object, Table *parent_tab
 				}
 			}
 
+			/* Only the relationships linked to the parent table (and the ones reached from them)
+			 are revalidated, the rest of the model is kept untouched */
 			if(revalidate_rels || ref_tab_inheritance)
 			{
-				disconnectRelationships();
-				validateRelationships();
+				QSet<BaseObject *> tabs;
+				tabs.insert(parent_tab);
+				validateRelationships(tabs);
 			}
 		}
 	}
@@ -5328,17 +6069,53 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type)
 }
 
 QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
+{
+	QBuffer buffer;
+
+	buffer.open(QBuffer::WriteOnly);
+	this->writeCodeDefinition(def_type, &buffer, export_file);
+	buffer.close();
+
+	return(QString(buffer.data()));
+}
+
+void DatabaseModel::writeCode(QIODevice *output, const QString &code, QCryptographicHash *checksum)
+{
+	if(!code.isEmpty())
+	{
+		string buf=code.toStdString();
+
+		if(output->write(buf.c_str(), buf.size()) < 0)
+		{
+			QFile *file=qobject_cast<QFile *>(output);
+
+			throw Exception(Exception::getErrorMessage(ERR_FILE_NOT_WRITTEN).arg(file ? file->fileName() : ""),
+											ERR_FILE_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__, NULL, output->errorString());
+		}
+
+		if(checksum)
+			checksum->addData(buf.c_str(), buf.size());
+	}
+}
+
+void DatabaseModel::writeCodeDefinition(unsigned def_type, QIODevice *output, bool export_file)
 {
 	map<QString, QString> attribs_aux;
-	unsigned count1, i, count;
+	unsigned count1, i, count, batch, batch_end;
+	int objs_pos, perms_pos;
 	float general_obj_cnt, gen_defs_count;
 	BaseObject *object=NULL;
 	vector<BaseObject *> *obj_list=NULL;
 	vector<BaseObject *>::iterator itr, itr_end;
-	vector<unsigned>::iterator itr1, itr1_end;
+	vector<CodeGenJob> jobs;
+	vector<CodeGenJob *> parallel_jobs, serial_jobs;
+	QCryptographicHash hash(QCryptographicHash::Sha1), *checksum=NULL;
+	qint64 start_pos=0, end_pos=0;
+	int chksum_pos=-1, hash_pos=0;
 	QString msg=trUtf8("Generating %1 of the object: %2 (%3)"),
 			attrib=ParsersAttributes::OBJECTS,
-			def_type_str=(def_type==SchemaParser::SQL_DEFINITION ? "SQL" : "XML");
+			def_type_str=(def_type==SchemaParser::SQL_DEFINITION ? "SQL" : "XML"),
+			objs_marker, perms_marker, model_def;
 	Type *usr_type=NULL;
 	map<unsigned, BaseObject *> objects_map;
 	vector<unsigned> ids_objs, ids_tab_objs;
@@ -5355,11 +6132,21 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 										OBJ_OPERATOR, OBJ_OPFAMILY, OBJ_OPCLASS,
 										OBJ_AGGREGATE, OBJ_DOMAIN, OBJ_TEXTBOX, BASE_RELATIONSHIP,
 										OBJ_RELATIONSHIP, OBJ_TABLE, OBJ_VIEW, OBJ_SEQUENCE };
+
+	if(!output)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
 	try
 	{
 		general_obj_cnt=this->getObjectCount();
 		gen_defs_count=0;
 
+		//Updates the name indexes before the parallel code generation since searches on them must not rebuild them
+		updateNameIndex();
+
+		//Discards the cached code of the objects affected by renamings
+		invalidateReferrersCode(def_type);
+
 		/* Treating the objects which have fixed ids, they are: Paper, table space,
 		 and Schema. They need to be treated separately in the loop down because they do not
 		 enter in the id sorting performed for other types of objects. */
@@ -5579,77 +6366,186 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 			}
 		}
 
-		itr1=ids_objs.begin();
-		itr1_end=ids_objs.end();
+		/* On SQL definition the database and the shell types are placed before the other objects on the
+		 model's code, so they are generated before the code of the objects starts to be written. The other
+		 objects have one generation job created (in the order of the ids) */
+		count=ids_objs.size();
+		jobs.reserve(count);
 
-		attrib=ParsersAttributes::OBJECTS;
-		while(itr1!=itr1_end)
+		for(i=0; i < count; i++)
 		{
-			object=objects_map[(*itr1)];
+			object=objects_map[ids_objs[i]];
 			obj_type=object->getObjectType();
-			itr1++;
 
-			if(obj_type==OBJ_TYPE && def_type==SchemaParser::SQL_DEFINITION)
+			if(def_type==SchemaParser::SQL_DEFINITION &&
+				 (obj_type==OBJ_DATABASE ||
+					(obj_type==OBJ_TYPE && dynamic_cast<Type *>(object)->getConfiguration()==Type::BASE_TYPE)))
 			{
-				usr_type=dynamic_cast<Type *>(object);
-
-				//Generating the shell type declaration (only for base types)
-				if(usr_type->getConfiguration()==Type::BASE_TYPE)
-					attribs_aux[ParsersAttributes::SHELL_TYPES]+=usr_type->getCodeDefinition(def_type, true);
+				if(obj_type==OBJ_DATABASE)
+					attribs_aux[this->getSchemaName()]+=this->__getCodeDefinition(def_type);
 				else
-					attribs_aux[attrib]+=usr_type->getCodeDefinition(def_type);
+					attribs_aux[ParsersAttributes::SHELL_TYPES]+=dynamic_cast<Type *>(object)->getCodeDefinition(def_type, true);
+
+				gen_defs_count++;
+				if(!signalsBlocked())
+				{
+					emit s_objectLoaded((gen_defs_count/general_obj_cnt) * 100,
+															msg.arg(def_type_str)
+															.arg(QString::fromUtf8(object->getName()))
+															.arg(object->getTypeName()),
+															object->getObjectType());
+				}
 			}
-			else if(obj_type==OBJ_DATABASE)
+			else
 			{
-				if(def_type==SchemaParser::SQL_DEFINITION)
-					attribs_aux[this->getSchemaName()]+=this->__getCodeDefinition(def_type);
-				else
-					attribs_aux[attrib]+=this->__getCodeDefinition(def_type);
+				jobs.push_back(CodeGenJob());
+				jobs.back().object=object;
+				jobs.back().def_type=def_type;
 			}
-			else if(obj_type==OBJ_CONSTRAINT)
+		}
+
+		/* The model's schema file is parsed only once using markers in place of the objects and permissions code.
+		 The parsed code is then written in parts while the code of the objects and permissions is written between
+		 them as soon as it is generated */
+		objs_marker=QString("\x01%1\x01").arg(ParsersAttributes::OBJECTS);
+		perms_marker=QString("\x01%1\x01").arg(ParsersAttributes::PERMISSION);
+
+		/* On XML definition the roles, tablespaces and schemas were generated as the first objects so
+		 their code is kept apart to be written right after the model's header */
+		attrib=attribs_aux[ParsersAttributes::OBJECTS];
+		attribs_aux[ParsersAttributes::OBJECTS]=objs_marker;
+		attribs_aux[ParsersAttributes::PERMISSION]=perms_marker;
+		attribs_aux[ParsersAttributes::MODEL_AUTHOR]=author;
+		attribs_aux[ParsersAttributes::EXPORT_TO_FILE]=(export_file ? "1" : "");
+
+		if(def_type==SchemaParser::XML_DEFINITION)
+		{
+			attribs_aux[ParsersAttributes::PROTECTED]=(this->is_protected ? "1" : "");
+
+			/* When the output permits random access the XML code receives a checksum (see XMLParser::isChecksumValid()).
+			 A placeholder is written on the header and replaced by the hash when all the code is written */
+			if(!output->isSequential())
 			{
-				attribs_aux[attrib]+=dynamic_cast<Constraint *>(object)->getCodeDefinition(def_type, true);
+				checksum=&hash;
+				attribs_aux[ParsersAttributes::CHECKSUM]=QString(40, '0');
 			}
 			else
+				attribs_aux[ParsersAttributes::CHECKSUM]="";
+		}
+
+		model_def=SchemaParser::getCodeDefinition(ParsersAttributes::DB_MODEL, attribs_aux, def_type);
+
+		if(checksum)
+		{
+			chksum_pos=model_def.indexOf(attribs_aux[ParsersAttributes::CHECKSUM]);
+
+			//Without the placeholder (customized schema file) the code is written without checksum
+			if(chksum_pos < 0)
+				checksum=NULL;
+			else
+				hash_pos=model_def.indexOf('\n', chksum_pos) + 1;
+		}
+
+		attribs_aux.clear();
+
+		objs_pos=model_def.indexOf(objs_marker);
+		perms_pos=model_def.indexOf(perms_marker);
+
+		if(objs_pos < 0 || perms_pos < objs_pos)
+			throw Exception(Exception::getErrorMessage(ERR_ASG_OBJ_INV_DEFINITION)
+											.arg(QString::fromUtf8(this->getName(true)))
+											.arg(this->getTypeName()),
+											ERR_ASG_OBJ_INV_DEFINITION,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		//The header is written apart since the hash covers only the code after the line of the checksum
+		start_pos=output->pos();
+		writeCode(output, model_def.left(hash_pos));
+		writeCode(output, model_def.mid(hash_pos, objs_pos - hash_pos), checksum);
+		writeCode(output, attrib, checksum);
+
+		/* The jobs are processed in batches so only the code of a limited number of objects is kept in memory.
+		 The objects of each batch have their code generated in parallel and written in the correct order */
+		count=jobs.size();
+		for(batch=0; batch < count; batch+=CODE_GEN_BATCH_SIZE)
+		{
+			batch_end=std::min(batch + CODE_GEN_BATCH_SIZE, count);
+			parallel_jobs.clear();
+			serial_jobs.clear();
+
+			for(i=batch; i < batch_end; i++)
 			{
-				if((obj_type==OBJ_LANGUAGE &&
-						(object->getName()==~LanguageType("c") ||
-						 object->getName()==~LanguageType("sql") ||
-						 object->getName()==~LanguageType("plpgsql"))))
-					attribs_aux[attrib]+="";
+				obj_type=jobs[i].object->getObjectType();
+
+				/* The database, relationships and table children (special objects) share objects with the tables code
+				 so they are generated serially. On XML definition, the objects that have the reduced form generated
+				 by others (schemas, roles, tablespaces, functions, languages, operators and operator classes) are generated
+				 serially too because their attributes can be in use by another thread (see BaseObject::getReferenceCodeDefinition()) */
+				if(obj_type==OBJ_DATABASE || obj_type==OBJ_RELATIONSHIP || obj_type==BASE_RELATIONSHIP ||
+					 obj_type==OBJ_CONSTRAINT || obj_type==OBJ_TRIGGER || obj_type==OBJ_INDEX || obj_type==OBJ_RULE ||
+					 (def_type==SchemaParser::XML_DEFINITION &&
+						(obj_type==OBJ_SCHEMA || obj_type==OBJ_ROLE || obj_type==OBJ_TABLESPACE ||
+						 obj_type==OBJ_FUNCTION || obj_type==OBJ_LANGUAGE ||
+						 obj_type==OBJ_OPERATOR || obj_type==OBJ_OPCLASS)))
+					serial_jobs.push_back(&jobs[i]);
 				else
-					attribs_aux[attrib]+=validateObjectDefinition(object, def_type);
+					parallel_jobs.push_back(&jobs[i]);
 			}
 
-			gen_defs_count++;
-			if(!signalsBlocked())
+			QtConcurrent::blockingMap(parallel_jobs, DatabaseModel::generateCodeDefinition);
+
+			for(i=0; i < serial_jobs.size(); i++)
+				generateCodeDefinition(serial_jobs[i]);
+
+			for(i=batch; i < batch_end; i++)
 			{
-				emit s_objectLoaded((gen_defs_count/general_obj_cnt) * 100,
-														msg.arg(def_type_str)
-														.arg(QString::fromUtf8(object->getName()))
-														.arg(object->getTypeName()),
-														object->getObjectType());
+				object=jobs[i].object;
+
+				if(jobs[i].error_raised)
+					throw jobs[i].error;
+
+				writeCode(output, jobs[i].code_def, checksum);
+				jobs[i].code_def.clear();
+
+				gen_defs_count++;
+				if(!signalsBlocked())
+				{
+					emit s_objectLoaded((gen_defs_count/general_obj_cnt) * 100,
+															msg.arg(def_type_str)
+															.arg(QString::fromUtf8(object->getName()))
+															.arg(object->getTypeName()),
+															object->getObjectType());
+				}
 			}
 		}
 
-		//Creates the SQL definition for user added foreign keys
 		if(def_type==SchemaParser::SQL_DEFINITION)
 		{
+			//Writes the SQL definition for user added foreign keys
 			while(!fks.empty())
 			{
-				attribs_aux[attrib]+=fks.back()->getCodeDefinition(def_type, true);
+				writeCode(output, fks.back()->getCodeDefinition(def_type, true), checksum);
 				fks.pop_back();
 			}
+
+			//Writes the complete definition of the base types (the shell types were written before)
+			count1=types.size();
+			for(i=0; i < count1; i++)
+			{
+				usr_type=dynamic_cast<Type *>(types[i]);
+				if(usr_type->getConfiguration()==Type::BASE_TYPE)
+					writeCode(output, usr_type->getCodeDefinition(def_type), checksum);
+			}
 		}
 
+		writeCode(output, model_def.mid(objs_pos + objs_marker.size(), perms_pos - (objs_pos + objs_marker.size())), checksum);
+
 		//Gernerating the SQL/XML code for permissions
 		itr=permissions.begin();
 		itr_end=permissions.end();
-		attribs_aux[ParsersAttributes::PERMISSION]="";
 
 		while(itr!=itr_end)
 		{
-			attribs_aux[ParsersAttributes::PERMISSION]+=dynamic_cast<Permission *>(*itr)->getCodeDefinition(def_type);
+			writeCode(output, dynamic_cast<Permission *>(*itr)->getCodeDefinition(def_type), checksum);
 
 			gen_defs_count++;
 			if(!signalsBlocked())
@@ -5664,23 +6560,29 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 			itr++;
 		}
 
-		attribs_aux[ParsersAttributes::MODEL_AUTHOR]=author;
+		writeCode(output, model_def.mid(perms_pos + perms_marker.size()), checksum);
 
-		if(def_type==SchemaParser::XML_DEFINITION)
+		//Replaces the placeholder on the header by the checksum
+		if(checksum)
 		{
-			attribs_aux[ParsersAttributes::PROTECTED]=(this->is_protected ? "1" : "");
+			end_pos=output->pos();
+
+			if(!output->seek(start_pos + chksum_pos))
+				throw Exception(Exception::getErrorMessage(ERR_FILE_NOT_WRITTEN).arg(""),
+												ERR_FILE_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__, NULL, output->errorString());
+
+			writeCode(output, QString(checksum->result().toHex()));
+			output->seek(end_pos);
 		}
-		else
+
+		if(def_type==SchemaParser::SQL_DEFINITION)
 		{
 			count1=types.size();
 			for(i=0; i < count1; i++)
 			{
 				usr_type=dynamic_cast<Type *>(types[i]);
 				if(usr_type->getConfiguration()==Type::BASE_TYPE)
-				{
-					attribs_aux[attrib]+=usr_type->getCodeDefinition(def_type);
 					usr_type->convertFunctionParameters(true);
-				}
 			}
 		}
 	}
@@ -5698,10 +6600,173 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 		}
 		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
+}
+
+void DatabaseModel::connectRelationships(RelConnectionJob &job)
+{
+	Relationship *rel=NULL;
+	Table *table_relnn=NULL;
+	unsigned i;
+
+	BaseObject::setReservedObjectIds(job.first_id, job.id_count);
+
+	for(i=0; i < job.relationships.size(); i++)
+	{
+		rel=job.relationships[i];
+
+		try
+		{
+			rel->connectRelationship();
+
+			/* The table that represents a n-n relationship is allocated by the connection so it is
+			 moved to the thread that owns the model, otherwise it would belong to the worker thread */
+			if(rel->getRelationshipType()==Relationship::RELATIONSHIP_NN)
+			{
+				table_relnn=rel->getReceiverTable();
+
+				if(table_relnn && job.thread && table_relnn->thread()!=job.thread)
+					table_relnn->moveToThread(job.thread);
+			}
+		}
+		catch(Exception &e)
+		{
+			job.failed_rels.push_back(rel);
+			job.errors.push_back(e);
+		}
+	}
+
+	//Discards the remaining reserved ids since the worker thread is reused by other jobs
+	job.ids_exhausted=BaseObject::isReservedObjectIdsExhausted();
+	BaseObject::setReservedObjectIds(0, 0);
+}
+
+void DatabaseModel::generateCodeDefinition(CodeGenJob *job)
+{
+	BaseObject *object=job->object;
+	ObjectType obj_type=object->getObjectType();
+	unsigned def_type=job->def_type;
+
+	//Objects that weren't changed since the last generation have their cached code reused
+	if(obj_type!=OBJ_DATABASE && object->getCachedCode(def_type, job->code_def))
+		return;
+
+	try
+	{
+		if(obj_type==OBJ_TYPE && def_type==SchemaParser::SQL_DEFINITION)
+			job->code_def=dynamic_cast<Type *>(object)->getCodeDefinition(def_type);
+		else if(obj_type==OBJ_DATABASE)
+			job->code_def=dynamic_cast<DatabaseModel *>(object)->__getCodeDefinition(def_type);
+		else if(obj_type==OBJ_CONSTRAINT)
+			job->code_def=dynamic_cast<Constraint *>(object)->getCodeDefinition(def_type, true);
+		else
+		{
+			if((obj_type==OBJ_LANGUAGE &&
+					(object->getName()==~LanguageType("c") ||
+					 object->getName()==~LanguageType("sql") ||
+					 object->getName()==~LanguageType("plpgsql"))))
+				job->code_def="";
+			else
+				job->code_def=validateObjectDefinition(object, def_type);
+		}
+	}
+	catch(Exception &e)
+	{
+		job->error=e;
+		job->error_raised=true;
+	}
+
+	if(!job->error_raised && obj_type!=OBJ_DATABASE)
+		object->setCachedCode(def_type, job->code_def);
+}
+
+void DatabaseModel::invalidateReferrersCode(unsigned def_type)
+{
+	ObjectType types[]={ OBJ_TEXTBOX, OBJ_TABLE, OBJ_FUNCTION, OBJ_AGGREGATE, OBJ_SCHEMA,
+											 OBJ_VIEW, OBJ_TYPE, OBJ_ROLE, OBJ_TABLESPACE, OBJ_LANGUAGE,
+											 OBJ_CAST, OBJ_CONVERSION, OBJ_OPERATOR, OBJ_OPCLASS,
+											 OBJ_OPFAMILY, OBJ_DOMAIN, OBJ_SEQUENCE, BASE_RELATIONSHIP, OBJ_RELATIONSHIP },
+			tab_obj_types[]={ OBJ_COLUMN, OBJ_CONSTRAINT, OBJ_TRIGGER, OBJ_INDEX, OBJ_RULE };
+	vector<BaseObject *> *obj_list=NULL, objs_queue, refs;
+	vector<BaseObject *>::iterator itr, itr_end;
+	QSet<BaseObject *> visited;
+	BaseObject *object=NULL;
+	BaseRelationship *rel=NULL;
+	Table *table=NULL;
+	unsigned i, i1, count;
+
+	//Gathers the objects (including the table children) which name was changed since the last generation
+	for(i=0; i < sizeof(types)/sizeof(ObjectType); i++)
+	{
+		obj_list=getObjectList(types[i]);
+		itr=obj_list->begin();
+		itr_end=obj_list->end();
+
+		while(itr!=itr_end)
+		{
+			object=(*itr);
+			itr++;
+
+			if(object->name_changed[def_type])
+				objs_queue.push_back(object);
+
+			if(object->getObjectType()==OBJ_TABLE)
+			{
+				table=dynamic_cast<Table *>(object);
+
+				for(i1=0; i1 < sizeof(tab_obj_types)/sizeof(ObjectType); i1++)
+				{
+					count=table->getObjectCount(tab_obj_types[i1]);
+
+					for(unsigned idx=0; idx < count; idx++)
+					{
+						object=table->getObject(idx, tab_obj_types[i1]);
+
+						if(object->name_changed[def_type])
+							objs_queue.push_back(object);
+					}
+				}
+			}
+		}
+	}
+
+	visited.insert(this);
+	for(i=0; i < objs_queue.size(); i++)
+		visited.insert(objs_queue[i]);
+
+	/* The code of the objects referencing a renamed object includes the old name so it is invalidated.
+	 Since the code of these objects may be referenced by others (e.g. function signatures) the invalidation
+	 is propagated through the references graph */
+	while(!objs_queue.empty())
+	{
+		object=objs_queue.back();
+		objs_queue.pop_back();
+		object->name_changed[def_type]=false;
+
+		getObjectReferences(object, refs);
+		itr=refs.begin();
+		itr_end=refs.end();
 
-	attribs_aux[ParsersAttributes::EXPORT_TO_FILE]=(export_file ? "1" : "");
+		while(itr!=itr_end)
+		{
+			object=(*itr);
+			itr++;
+			object->setCodeInvalidated();
 
-	return(SchemaParser::getCodeDefinition(ParsersAttributes::DB_MODEL, attribs_aux, def_type));
+			//The code of the tables linked by relationship includes the tables names (e.g. inheritance)
+			if(object->getObjectType()==OBJ_RELATIONSHIP || object->getObjectType()==BASE_RELATIONSHIP)
+			{
+				rel=dynamic_cast<BaseRelationship *>(object);
+				rel->getTable(BaseRelationship::SRC_TABLE)->setCodeInvalidated();
+				rel->getTable(BaseRelationship::DST_TABLE)->setCodeInvalidated();
+			}
+
+			if(!visited.contains(object))
+			{
+				visited.insert(object);
+				objs_queue.push_back(object);
+			}
+		}
+	}
 }
 
 void DatabaseModel::saveModel(const QString &filename, unsigned def_type)
@@ -5719,8 +6784,7 @@ void DatabaseModel::saveModel(const QString &filename, unsigned def_type)
 
 	try
 	{
-		str_aux=this->getCodeDefinition(def_type);
-		output.write(str_aux.toStdString().c_str(),str_aux.size());
+		this->writeCodeDefinition(def_type, &output);
 		output.close();
 	}
 	catch(Exception &e)
@@ -5733,26 +6797,65 @@ void DatabaseModel::saveModel(const QString &filename, unsigned def_type)
 
 void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *> &deps, bool inc_indirect_deps)
 {
-	//Case the object is allocated and is not included in the dependecies list
-	if(object && std::find(deps.begin(), deps.end(), object)==deps.end())
+	vector<BaseObject *> objs;
+
+	objs.push_back(object);
+	getObjectDependecies(objs, deps, inc_indirect_deps);
+}
+
+void DatabaseModel::getObjectDependecies(vector<BaseObject *> &objs, vector<BaseObject *> &deps, bool inc_indirect_deps)
+{
+	QSet<BaseObject *> visited;
+	vector<BaseObject *>::iterator itr, itr_end;
+
+	//The objects already on the dependencies list are not visited again
+	itr=deps.begin();
+	itr_end=deps.end();
+	while(itr!=itr_end)
+	{
+		visited.insert(*itr);
+		itr++;
+	}
+
+	itr=objs.begin();
+	itr_end=objs.end();
+	while(itr!=itr_end)
 	{
-		deps.push_back(object);
+		__getObjectDependecies(*itr, deps, inc_indirect_deps, visited, true);
+		itr++;
+	}
+}
 
+void DatabaseModel::__getObjectDependecies(BaseObject *object, vector<BaseObject *> &deps, bool inc_indirect_deps,
+																					 QSet<BaseObject *> &visited, bool is_root)
+{
+	/* Case the object is allocated and was not visited yet. The objects passed to getObjectDependecies()
+		 are always visited since they can be included on the list as dependency of a previous one */
+	if(object && (is_root || !visited.contains(object)))
+	{
+		//Case the object is not included in the dependecies list
+		if(!visited.contains(object))
+		{
+			visited.insert(object);
+			deps.push_back(object);
+		}
 
-		if((deps.size()==1 && !inc_indirect_deps) || inc_indirect_deps)
+		/* Without the indirect dependencies only the direct dependencies of the objects
+			 passed to getObjectDependecies() are searched */
+		if(is_root || inc_indirect_deps)
 		{
 			ObjectType obj_type=object->getObjectType();
 
 			/* if the object has a schema, tablespace and owner applies the
 		 dependecy search in these objects */
 			if(object->getSchema() && inc_indirect_deps)
-				getObjectDependecies(object->getSchema(), deps, inc_indirect_deps);
+				__getObjectDependecies(object->getSchema(), deps, inc_indirect_deps, visited);
 
 			if(object->getTablespace() && inc_indirect_deps)
-				getObjectDependecies(object->getTablespace(), deps, inc_indirect_deps);
+				__getObjectDependecies(object->getTablespace(), deps, inc_indirect_deps, visited);
 
 			if(object->getOwner()  && inc_indirect_deps)
-				getObjectDependecies(object->getOwner(), deps, inc_indirect_deps);
+				__getObjectDependecies(object->getOwner(), deps, inc_indirect_deps, visited);
 
 			//** Getting the dependecies for operator class **
 			if(obj_type==OBJ_OPCLASS)
@@ -5761,10 +6864,10 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 				BaseObject *usr_type=getObjectPgSQLType(op_class->getDataType());
 
 				if(usr_type)
-					getObjectDependecies(usr_type, deps, inc_indirect_deps);
+					__getObjectDependecies(usr_type, deps, inc_indirect_deps, visited);
 
 				if(op_class->getFamily())
-					getObjectDependecies(op_class->getFamily(), deps, inc_indirect_deps);
+					__getObjectDependecies(op_class->getFamily(), deps, inc_indirect_deps, visited);
 			}
 			//** Getting the dependecies for domain **
 			else if(obj_type==OBJ_DOMAIN)
@@ -5772,13 +6875,13 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 				BaseObject *usr_type=getObjectPgSQLType(dynamic_cast<Domain *>(object)->getType());
 
 				if(usr_type)
-					getObjectDependecies(usr_type, deps, inc_indirect_deps);
+					__getObjectDependecies(usr_type, deps, inc_indirect_deps, visited);
 			}
 			//** Getting the dependecies for conversion **
 			else if(obj_type==OBJ_CONVERSION)
 			{
 				Function *func=dynamic_cast<Conversion *>(object)->getConversionFunction();
-				getObjectDependecies(func, deps, inc_indirect_deps);
+				__getObjectDependecies(func, deps, inc_indirect_deps, visited);
 			}
 			//** Getting the dependecies for cast **
 			else if(obj_type==OBJ_CAST)
@@ -5791,10 +6894,10 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 					usr_type=getObjectPgSQLType(cast->getDataType(i));
 
 					if(usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
+						__getObjectDependecies(usr_type, deps, inc_indirect_deps, visited);
 				}
 
-				getObjectDependecies(cast->getCastFunction(), deps, inc_indirect_deps);
+				__getObjectDependecies(cast->getCastFunction(), deps, inc_indirect_deps, visited);
 			}
 			//** Getting the dependecies for function **
 			else if(obj_type==OBJ_FUNCTION)
@@ -5805,10 +6908,10 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 
 				if(func->getLanguage()->getName()!=~LanguageType("c") &&
 					 func->getLanguage()->getName()!=~LanguageType("sql"))
-					getObjectDependecies(func->getLanguage(), deps, inc_indirect_deps);
+					__getObjectDependecies(func->getLanguage(), deps, inc_indirect_deps, visited);
 
 				if(usr_type)
-					getObjectDependecies(usr_type, deps, inc_indirect_deps);
+					__getObjectDependecies(usr_type, deps, inc_indirect_deps, visited);
 
 				count=func->getParameterCount();
 				for(i=0; i < count; i++)
@@ -5816,7 +6919,7 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 					usr_type=getObjectPgSQLType(func->getParameter(i).getType());
 
 					if(usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
+						__getObjectDependecies(usr_type, deps, inc_indirect_deps, visited);
 				}
 
 				count=func->getReturnedTableColumnCount();
@@ -5825,7 +6928,7 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 					usr_type=getObjectPgSQLType(func->getReturnedTableColumn(i).getType());
 
 					if(usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
+						__getObjectDependecies(usr_type, deps, inc_indirect_deps, visited);
 				}
 			}
 			//** Getting the dependecies for aggregate **
@@ -5836,15 +6939,15 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 				unsigned count, i;
 
 				for(i=Aggregate::FINAL_FUNC; i <= Aggregate::TRANSITION_FUNC; i++)
-					getObjectDependecies(aggreg->getFunction(i), deps, inc_indirect_deps);
+					__getObjectDependecies(aggreg->getFunction(i), deps, inc_indirect_deps, visited);
 
 				usr_type=getObjectPgSQLType(aggreg->getStateType());
 
 				if(usr_type)
-					getObjectDependecies(usr_type, deps, inc_indirect_deps);
+					__getObjectDependecies(usr_type, deps, inc_indirect_deps, visited);
 
 				if(aggreg->getSortOperator())
-					getObjectDependecies(aggreg->getSortOperator(), deps, inc_indirect_deps);
+					__getObjectDependecies(aggreg->getSortOperator(), deps, inc_indirect_deps, visited);
 
 				count=aggreg->getDataTypeCount();
 				for(i=0; i < count; i++)
@@ -5852,7 +6955,7 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 					usr_type=getObjectPgSQLType(aggreg->getDataType(i));
 
 					if(usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
+						__getObjectDependecies(usr_type, deps, inc_indirect_deps, visited);
 				}
 			}
 			//** Getting the dependecies for language **
@@ -5863,7 +6966,7 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 				for(unsigned i=Language::VALIDATOR_FUNC; i <= Language::INLINE_FUNC; i++)
 				{
 					if(lang->getFunction(i))
-						getObjectDependecies(lang->getFunction(i), deps, inc_indirect_deps);
+						__getObjectDependecies(lang->getFunction(i), deps, inc_indirect_deps, visited);
 				}
 			}
 			//** Getting the dependecies for operator **
@@ -5876,7 +6979,7 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 				for(i=Operator::FUNC_OPERATOR; i <= Operator::FUNC_RESTRICTION; i++)
 				{
 					if(oper->getFunction(i))
-						getObjectDependecies(oper->getFunction(i), deps, inc_indirect_deps);
+						__getObjectDependecies(oper->getFunction(i), deps, inc_indirect_deps, visited);
 				}
 
 				for(i=Operator::LEFT_ARG; i <= Operator::RIGHT_ARG; i++)
@@ -5884,13 +6987,13 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 					usr_type=getObjectPgSQLType(oper->getArgumentType(i));
 
 					if(usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
+						__getObjectDependecies(usr_type, deps, inc_indirect_deps, visited);
 				}
 
 				for(i=Operator::OPER_COMMUTATOR; i <= Operator::OPER_GREATER; i++)
 				{
 					if(oper->getOperator(i))
-						getObjectDependecies(oper->getOperator(i), deps, inc_indirect_deps);
+						__getObjectDependecies(oper->getOperator(i), deps, inc_indirect_deps, visited);
 				}
 			}
 			//** Getting the dependecies for role **
@@ -5904,7 +7007,7 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 				{
 					count=role->getRoleCount(role_types[i]);
 					for(i1=0; i1 < count; i1++)
-						getObjectDependecies(role->getRole(role_types[i], i1), deps, inc_indirect_deps);
+						__getObjectDependecies(role->getRole(role_types[i], i1), deps, inc_indirect_deps, visited);
 				}
 			}
 			//** Getting the dependecies for relationships **
@@ -5915,8 +7018,8 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 				Constraint *constr=NULL;
 				unsigned i, count;
 
-				getObjectDependecies(rel->getTable(Relationship::SRC_TABLE), deps, inc_indirect_deps);
-				getObjectDependecies(rel->getTable(Relationship::DST_TABLE), deps, inc_indirect_deps);
+				__getObjectDependecies(rel->getTable(Relationship::SRC_TABLE), deps, inc_indirect_deps, visited);
+				__getObjectDependecies(rel->getTable(Relationship::DST_TABLE), deps, inc_indirect_deps, visited);
 
 				count=rel->getAttributeCount();
 				for(i=0; i < count; i++)
@@ -5924,7 +7027,7 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 					usr_type=getObjectPgSQLType(rel->getAttribute(i)->getType());
 
 					if(usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
+						__getObjectDependecies(usr_type, deps, inc_indirect_deps, visited);
 				}
 
 				count=rel->getConstraintCount();
@@ -5933,7 +7036,7 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 					constr=dynamic_cast<Constraint *>(rel->getConstraint(i));
 
 					if(constr->getTablespace())
-						getObjectDependecies(constr->getTablespace(), deps, inc_indirect_deps);
+						__getObjectDependecies(constr->getTablespace(), deps, inc_indirect_deps, visited);
 				}
 			}
 			//** Getting the dependecies for sequence **
@@ -5941,7 +7044,7 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 			{
 				Sequence *seq=dynamic_cast<Sequence *>(object);
 				if(seq->getOwnerColumn())
-					getObjectDependecies(seq->getOwnerColumn()->getParentTable(), deps, inc_indirect_deps);
+					__getObjectDependecies(seq->getOwnerColumn()->getParentTable(), deps, inc_indirect_deps, visited);
 			}
 			//** Getting the dependecies for table **
 			else if(obj_type==OBJ_TABLE)
@@ -5961,7 +7064,7 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 					usr_type=getObjectPgSQLType(col->getType());
 
 					if(!col->isAddedByLinking() && usr_type)
-						getObjectDependecies(usr_type, deps, inc_indirect_deps);
+						__getObjectDependecies(usr_type, deps, inc_indirect_deps, visited);
 				}
 
 				count=tab->getConstraintCount();
@@ -5971,10 +7074,10 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 					if(inc_indirect_deps &&
 						 !constr->isAddedByLinking() &&
 						 constr->getConstraintType()==ConstraintType::foreign_key)
-						getObjectDependecies(constr->getReferencedTable(), deps, inc_indirect_deps);
+						__getObjectDependecies(constr->getReferencedTable(), deps, inc_indirect_deps, visited);
 
 					if(!constr->isAddedByLinking() && constr->getTablespace())
-						getObjectDependecies(constr->getTablespace(), deps, inc_indirect_deps);
+						__getObjectDependecies(constr->getTablespace(), deps, inc_indirect_deps, visited);
 				}
 
 				count=tab->getTriggerCount();
@@ -5982,10 +7085,10 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 				{
 					trig=dynamic_cast<Trigger *>(tab->getTrigger(i));
 					if(trig->getReferencedTable())
-						getObjectDependecies(trig->getReferencedTable(), deps, inc_indirect_deps);
+						__getObjectDependecies(trig->getReferencedTable(), deps, inc_indirect_deps, visited);
 
 					if(trig->getFunction())
-						getObjectDependecies(trig->getFunction(), deps, inc_indirect_deps);
+						__getObjectDependecies(trig->getFunction(), deps, inc_indirect_deps, visited);
 				}
 
 				count=tab->getIndexCount();
@@ -5997,13 +7100,13 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 					for(i1=0; i1 < count1; i1++)
 					{
 						if(index->getElement(i1).getOperatorClass())
-							getObjectDependecies(index->getElement(i1).getOperatorClass(), deps, inc_indirect_deps);
+							__getObjectDependecies(index->getElement(i1).getOperatorClass(), deps, inc_indirect_deps, visited);
 						else if(index->getElement(i1).getColumn())
 						{
 							usr_type=getObjectPgSQLType(index->getElement(i1).getColumn()->getType());
 
 							if(usr_type)
-								getObjectDependecies(usr_type, deps, inc_indirect_deps);
+								__getObjectDependecies(usr_type, deps, inc_indirect_deps, visited);
 						}
 					}
 				}
@@ -6020,10 +7123,10 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 					aux_type=getObjectPgSQLType(usr_type->getLikeType());
 
 					if(aux_type)
-						getObjectDependecies(aux_type, deps, inc_indirect_deps);
+						__getObjectDependecies(aux_type, deps, inc_indirect_deps, visited);
 
 					for(i=Type::INPUT_FUNC; i <= Type::ANALYZE_FUNC; i++)
-						getObjectDependecies(usr_type->getFunction(i), deps, inc_indirect_deps);
+						__getObjectDependecies(usr_type->getFunction(i), deps, inc_indirect_deps, visited);
 				}
 				else if(usr_type->getConfiguration()==Type::COMPOSITE_TYPE)
 				{
@@ -6033,7 +7136,7 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 						aux_type=getObjectPgSQLType(usr_type->getAttribute(i).getType());
 
 						if(aux_type)
-							getObjectDependecies(aux_type, deps, inc_indirect_deps);
+							__getObjectDependecies(aux_type, deps, inc_indirect_deps, visited);
 					}
 				}
 			}
@@ -6047,750 +7150,442 @@ void DatabaseModel::getObjectDependecies(BaseObject *object, vector<BaseObject *
 				for(i=0; i < count; i++)
 				{
 					if(view->getReference(i).getTable())
-						getObjectDependecies(view->getReference(i).getTable(), deps, inc_indirect_deps);
+						__getObjectDependecies(view->getReference(i).getTable(), deps, inc_indirect_deps, visited);
 				}
 			}
 		}
 	}
 }
 
-void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclusion_mode)
+void DatabaseModel::getReferenceEdges(BaseObject *object, vector<pair<BaseObject *, BaseObject *> > &edges)
 {
-	refs.clear();
+	ObjectType obj_type=object->getObjectType();
+	BaseObject *usr_type=NULL;
+	unsigned i, i1, count;
 
-	if(object)
+	//Schema, owner and tablespace references
+	if(object->getSchema())
+		edges.push_back(make_pair(object->getSchema(), object));
+
+	if(object->getOwner())
+		edges.push_back(make_pair(object->getOwner(), object));
+
+	if(object->getTablespace())
+		edges.push_back(make_pair(object->getTablespace(), object));
+
+	if(obj_type==OBJ_TABLE)
 	{
-		ObjectType obj_type=object->getObjectType();
-		bool refer=false;
+		Table *table=dynamic_cast<Table *>(object);
+		Column *col=NULL;
+		Constraint *constr=NULL;
+		Trigger *trig=NULL;
+		Index *index=NULL;
+		unsigned col_types[2]={ Constraint::SOURCE_COLS, Constraint::REFERENCED_COLS };
 
-		if(obj_type==OBJ_TABLE)
+		count=table->getColumnCount();
+		for(i=0; i < count; i++)
 		{
-			Table *table=dynamic_cast<Table *>(object);
-			Sequence *seq=NULL;
-			Constraint *constr=NULL;
-			Table *tab=NULL;
-			Trigger *gat=NULL;
-			BaseRelationship *base_rel=NULL;
-			vector<BaseObject *>::iterator itr, itr_end;
-			unsigned i, count;
+			col=table->getColumn(i);
+			usr_type=getObjectPgSQLType(col->getType());
 
-			itr=relationships.begin();
-			itr_end=relationships.end();
+			if(usr_type)
+				edges.push_back(make_pair(usr_type, col));
+		}
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				base_rel=dynamic_cast<BaseRelationship *>(*itr);
-				if(base_rel->getTable(BaseRelationship::SRC_TABLE)==table ||
-					 base_rel->getTable(BaseRelationship::DST_TABLE)==table)
-				{
-					refer=true;
-					refs.push_back(base_rel);
-				}
-				itr++;
-			}
+		count=table->getConstraintCount();
+		for(i=0; i < count; i++)
+		{
+			constr=table->getConstraint(i);
 
-			itr=sequences.begin();
-			itr_end=sequences.end();
+			if(constr->getConstraintType()==ConstraintType::foreign_key && constr->getReferencedTable())
+				edges.push_back(make_pair(constr->getReferencedTable(), constr));
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			if(constr->getTablespace())
+				edges.push_back(make_pair(constr->getTablespace(), constr));
+
+			for(i1=0; i1 < 2; i1++)
 			{
-				seq=dynamic_cast<Sequence *>(*itr);
-				if(seq->getOwnerColumn() &&
-					 seq->getOwnerColumn()->getParentTable()==table)
-				{
-					refer=true;
-					refs.push_back(seq);
-				}
+				unsigned col_cnt=constr->getColumnCount(col_types[i1]);
 
-				itr++;
+				for(unsigned col_idx=0; col_idx < col_cnt; col_idx++)
+					edges.push_back(make_pair(constr->getColumn(col_idx, col_types[i1]), constr));
 			}
+		}
 
-			itr=tables.begin();
-			itr_end=tables.end();
+		count=table->getTriggerCount();
+		for(i=0; i < count; i++)
+		{
+			trig=table->getTrigger(i);
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				tab=dynamic_cast<Table *>(*itr);
+			if(trig->getReferencedTable())
+				edges.push_back(make_pair(trig->getReferencedTable(), trig));
 
-				count=tab->getConstraintCount();
-				for(i=0; i < count&& (!exclusion_mode || (exclusion_mode && !refer)); i++)
-				{
-					constr=tab->getConstraint(i);
-					if(constr->getConstraintType()==ConstraintType::foreign_key &&
-						 constr->getReferencedTable()==table)
-					{
-						refer=true;
-						refs.push_back(constr);
-					}
-				}
+			if(trig->getFunction())
+				edges.push_back(make_pair(trig->getFunction(), trig));
 
-				count=tab->getTriggerCount();
-				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-				{
-					gat=tab->getTrigger(i);
-					if(gat->getReferencedTable()==table)
-					{
-						refer=true;
-						refs.push_back(gat);
-					}
-				}
+			for(i1=0; i1 < trig->getColumnCount(); i1++)
+				edges.push_back(make_pair(trig->getColumn(i1), trig));
+		}
 
-				itr++;
-			}
+		count=table->getIndexCount();
+		for(i=0; i < count; i++)
+		{
+			index=table->getIndex(i);
 
+			if(index->getTablespace())
+				edges.push_back(make_pair(index->getTablespace(), index));
+		}
+	}
+	else if(obj_type==OBJ_RELATIONSHIP || obj_type==BASE_RELATIONSHIP)
+	{
+		BaseRelationship *base_rel=dynamic_cast<BaseRelationship *>(object);
+		BaseObject *src_tab=base_rel->getTable(BaseRelationship::SRC_TABLE),
+				*dst_tab=base_rel->getTable(BaseRelationship::DST_TABLE);
 
-			itr=base_relationships.begin();
-			itr_end=base_relationships.end();
+		if(obj_type==OBJ_RELATIONSHIP)
+		{
+			Relationship *rel=dynamic_cast<Relationship *>(object);
+			Constraint *constr=NULL;
+			unsigned col_types[2]={ Constraint::SOURCE_COLS, Constraint::REFERENCED_COLS };
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
+			edges.push_back(make_pair(src_tab, rel));
+			edges.push_back(make_pair(dst_tab, rel));
+
+			count=rel->getConstraintCount();
+			for(i=0; i < count; i++)
 			{
-				base_rel=dynamic_cast<BaseRelationship *>(*itr);
-				if(base_rel->getTable(BaseRelationship::SRC_TABLE)==table)
-				{
-					refer=true;
-					refs.push_back(base_rel->getTable(BaseRelationship::DST_TABLE));
-				}
-				else if(base_rel->getTable(BaseRelationship::DST_TABLE)==table)
+				constr=rel->getConstraint(i);
+
+				for(i1=0; i1 < 2; i1++)
 				{
-					refer=true;
-					refs.push_back(base_rel->getTable(BaseRelationship::SRC_TABLE));
+					unsigned col_cnt=constr->getColumnCount(col_types[i1]);
+
+					for(unsigned col_idx=0; col_idx < col_cnt; col_idx++)
+						edges.push_back(make_pair(constr->getColumn(col_idx, col_types[i1]), rel));
 				}
-				itr++;
 			}
 		}
+		/* For table-view relationships (and other base relationships) each table is referenced
+			 by the table on the other side of the relationship */
+		else
+		{
+			edges.push_back(make_pair(src_tab, dst_tab));
+
+			if(src_tab!=dst_tab)
+				edges.push_back(make_pair(dst_tab, src_tab));
+		}
+	}
+	else if(obj_type==OBJ_SEQUENCE)
+	{
+		Sequence *seq=dynamic_cast<Sequence *>(object);
 
-		if(obj_type==OBJ_FUNCTION)
+		if(seq->getOwnerColumn())
 		{
-			Function *func=dynamic_cast<Function *>(object);
-			vector<BaseObject *> *obj_list=NULL;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType obj_types[7]={OBJ_CAST, OBJ_CONVERSION,
-															 OBJ_AGGREGATE, OBJ_OPERATOR,
-															 OBJ_TABLE, OBJ_TYPE, OBJ_LANGUAGE };
-			unsigned i, i1, count;
-			Table *tab=NULL;
-			Aggregate *aggreg=NULL;
-			Operator *oper=NULL;
-			Trigger *trig=NULL;
-			Type *type=NULL;
-			Language *lang=NULL;
-
-			for(i=0; i < 7 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
+			edges.push_back(make_pair(seq->getOwnerColumn(), seq));
 
-				if(obj_types[i]==OBJ_CAST)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						if(dynamic_cast<Cast *>(*itr)->getCastFunction()==func)
-						{
-							refer=true;
-							refs.push_back(*itr);
-						}
-						itr++;
-					}
-				}
-				else if(obj_types[i]==OBJ_CONVERSION)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						if(dynamic_cast<Conversion *>(*itr)->getConversionFunction()==func)
-						{
-							refer=true;
-							refs.push_back(*itr);
-						}
-						itr++;
-					}
-				}
-				else if(obj_types[i]==OBJ_AGGREGATE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						aggreg=dynamic_cast<Aggregate *>(*itr);
+			if(seq->getOwnerColumn()->getParentTable())
+				edges.push_back(make_pair(seq->getOwnerColumn()->getParentTable(), seq));
+		}
+	}
+	else if(obj_type==OBJ_VIEW)
+	{
+		View *view=dynamic_cast<View *>(object);
 
-						if(aggreg->getFunction(Aggregate::FINAL_FUNC)==func ||
-							 aggreg->getFunction(Aggregate::TRANSITION_FUNC)==func)
-						{
-							refer=true;
-							refs.push_back(aggreg);
-						}
-						itr++;
-					}
-				}
-				else if(obj_types[i]==OBJ_OPERATOR)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						oper=dynamic_cast<Operator *>(*itr);
+		count=view->getReferenceCount();
+		for(i=0; i < count; i++)
+		{
+			if(view->getReference(i).getColumn())
+				edges.push_back(make_pair(view->getReference(i).getColumn(), view));
+		}
+	}
+	else if(obj_type==OBJ_FUNCTION)
+	{
+		Function *func=dynamic_cast<Function *>(object);
 
-						if(oper->getFunction(Operator::FUNC_OPERATOR)==func ||
-							 oper->getFunction(Operator::FUNC_JOIN)==func  ||
-							 oper->getFunction(Operator::FUNC_RESTRICTION)==func)
-						{
-							refer=true;
-							refs.push_back(oper);
-						}
-						itr++;
-					}
-				}
-				else if(obj_types[i]==OBJ_TABLE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						tab=dynamic_cast<Table *>(*itr);
-						itr++;
-						count=tab->getTriggerCount();
+		if(func->getLanguage())
+			edges.push_back(make_pair(func->getLanguage(), func));
 
-						for(i1=0; i1 < count && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							trig=tab->getTrigger(i1);
+		usr_type=getObjectPgSQLType(func->getReturnType());
+		if(usr_type)
+			edges.push_back(make_pair(usr_type, func));
 
-							if(trig->getFunction()==func)
-							{
-								refer=true;
-								refs.push_back(trig);
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_TYPE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						type=dynamic_cast<Type *>(*itr);
-						itr++;
-
-						for(i1=Type::INPUT_FUNC; i1 <= Type::ANALYZE_FUNC && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							if(type->getFunction(i1)==func)
-							{
-								refer=true;
-								refs.push_back(type);
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_LANGUAGE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						lang=dynamic_cast<Language *>(*itr);
-						itr++;
+		count=func->getParameterCount();
+		for(i=0; i < count; i++)
+		{
+			usr_type=getObjectPgSQLType(func->getParameter(i).getType());
 
-						if(lang->getFunction(Language::HANDLER_FUNC)==func ||
-							 lang->getFunction(Language::VALIDATOR_FUNC)==func ||
-							 lang->getFunction(Language::INLINE_FUNC)==func)
-						{
-							refer=true;
-							refs.push_back(lang);
-						}
-					}
-				}
-			}
+			if(usr_type)
+				edges.push_back(make_pair(usr_type, func));
 		}
+	}
+	else if(obj_type==OBJ_CAST)
+	{
+		Cast *cast=dynamic_cast<Cast *>(object);
 
-		if(obj_type==OBJ_SCHEMA)
-		{
-			vector<BaseObject *> *obj_list=NULL;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType obj_types[11]={OBJ_FUNCTION, OBJ_TABLE, OBJ_VIEW,
-																OBJ_DOMAIN, OBJ_AGGREGATE, OBJ_OPERATOR,
-																OBJ_SEQUENCE, OBJ_CONVERSION,
-																OBJ_TYPE, OBJ_OPFAMILY, OBJ_OPCLASS};
-			unsigned i;
+		if(cast->getCastFunction())
+			edges.push_back(make_pair(cast->getCastFunction(), cast));
 
-			for(i=0; i < 11 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
+		for(i=Cast::SRC_TYPE; i <= Cast::DST_TYPE; i++)
+		{
+			usr_type=getObjectPgSQLType(cast->getDataType(i));
 
-				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-				{
-					if((*itr)->getSchema()==object)
-					{
-						refer=true;
-						refs.push_back(*itr);
-					}
-					itr++;
-				}
-			}
+			if(usr_type)
+				edges.push_back(make_pair(usr_type, cast));
 		}
+	}
+	else if(obj_type==OBJ_CONVERSION)
+	{
+		Conversion *conv=dynamic_cast<Conversion *>(object);
 
-		if(obj_type==OBJ_TYPE || obj_type==OBJ_DOMAIN ||
-			 obj_type==OBJ_SEQUENCE || obj_type==OBJ_TABLE)
-		{
-			vector<BaseObject *> *obj_list=NULL;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType obj_types[]={OBJ_TABLE, OBJ_OPCLASS, OBJ_CAST,
-															OBJ_DOMAIN, OBJ_FUNCTION, OBJ_AGGREGATE,
-															OBJ_OPERATOR, OBJ_TYPE };
-			unsigned i, i1, count;
-			OperatorClass *op_class=NULL;
-			Table *tab=NULL;
-			Column *col=NULL;
-			Cast *cast=NULL;
-			Domain *dom=NULL;
-			Function *func=NULL;
-			Aggregate *aggreg=NULL;
-			Operator *oper=NULL;
-			Type *type=NULL;
-			void *ptr_pgsqltype=NULL;
-
-			switch(obj_type)
-			{
-				case OBJ_TYPE: ptr_pgsqltype=dynamic_cast<Type*>(object); break;
-				case OBJ_DOMAIN: ptr_pgsqltype=dynamic_cast<Domain*>(object); break;
-				case OBJ_SEQUENCE: ptr_pgsqltype=dynamic_cast<Sequence*>(object); break;
-				default: ptr_pgsqltype=dynamic_cast<Table*>(object); break;
-			}
+		if(conv->getConversionFunction())
+			edges.push_back(make_pair(conv->getConversionFunction(), conv));
+	}
+	else if(obj_type==OBJ_AGGREGATE)
+	{
+		Aggregate *aggreg=dynamic_cast<Aggregate *>(object);
 
-			for(i=0; i < 8 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
+		for(i=Aggregate::FINAL_FUNC; i <= Aggregate::TRANSITION_FUNC; i++)
+		{
+			if(aggreg->getFunction(i))
+				edges.push_back(make_pair(aggreg->getFunction(i), aggreg));
+		}
 
-				if(obj_types[i]==OBJ_TABLE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						tab=dynamic_cast<Table *>(*itr);
-						itr++;
+		count=aggreg->getDataTypeCount();
+		for(i=0; i < count; i++)
+		{
+			usr_type=getObjectPgSQLType(aggreg->getDataType(i));
 
-						count=tab->getColumnCount();
-						for(i1=0; i1 < count && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							col=tab->getColumn(i1);
+			if(usr_type)
+				edges.push_back(make_pair(usr_type, aggreg));
+		}
 
-							if(col->getType()==object)
-							{
-								refer=true;
-								refs.push_back(col);
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_OPCLASS)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						op_class=dynamic_cast<OperatorClass *>(*itr);
-						itr++;
+		if(aggreg->getSortOperator())
+			edges.push_back(make_pair(aggreg->getSortOperator(), aggreg));
+	}
+	else if(obj_type==OBJ_OPERATOR)
+	{
+		Operator *oper=dynamic_cast<Operator *>(object);
 
-						if(op_class->getDataType()==ptr_pgsqltype)
-						{
-							refer=true;
-							refs.push_back(op_class);
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_DOMAIN)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						dom=dynamic_cast<Domain *>(*itr);
-						itr++;
+		for(i=Operator::FUNC_OPERATOR; i <= Operator::FUNC_RESTRICTION; i++)
+		{
+			if(oper->getFunction(i))
+				edges.push_back(make_pair(oper->getFunction(i), oper));
+		}
 
-						if(dom->getType()==ptr_pgsqltype)
-						{
-							refer=true;
-							refs.push_back(dom);
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_TYPE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						type=dynamic_cast<Type *>(*itr);
-						itr++;
+		for(i=Operator::LEFT_ARG; i <= Operator::RIGHT_ARG; i++)
+		{
+			usr_type=getObjectPgSQLType(oper->getArgumentType(i));
 
-						if(type->getAlignment()==ptr_pgsqltype ||
-							 type->getElement()==ptr_pgsqltype ||
-							 type->getLikeType()==ptr_pgsqltype)
-						{
-							refer=true;
-							refs.push_back(type);
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_AGGREGATE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						aggreg=dynamic_cast<Aggregate *>(*itr);
-						itr++;
+			if(usr_type)
+				edges.push_back(make_pair(usr_type, oper));
+		}
 
-						count=aggreg->getDataTypeCount();
-						for(i1=0; i1 < count  && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							if(aggreg->getDataType(i1)==ptr_pgsqltype)
-							{
-								refer=true;
-								refs.push_back(aggreg);
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_FUNCTION)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						func=dynamic_cast<Function *>(*itr);
-						itr++;
+		for(i=Operator::OPER_COMMUTATOR; i <= Operator::OPER_GREATER; i++)
+		{
+			if(oper->getOperator(i))
+				edges.push_back(make_pair(oper->getOperator(i), oper));
+		}
+	}
+	else if(obj_type==OBJ_TYPE)
+	{
+		Type *type=dynamic_cast<Type *>(object);
+		PgSQLType types[3]={ type->getAlignment(), type->getElement(), type->getLikeType() };
 
-						if(func->getReturnType()==ptr_pgsqltype)
-						{
-							refer=true;
-							refs.push_back(func);
-						}
-						else
-						{
-							count=func->getParameterCount();
-							for(i1=0; i1 < count && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-							{
-								if(func->getParameter(i1).getType()==ptr_pgsqltype)
-								{
-									refer=true;
-									refs.push_back(func);
-								}
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_OPERATOR)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						oper=dynamic_cast<Operator *>(*itr);
-						itr++;
+		for(i=Type::INPUT_FUNC; i <= Type::ANALYZE_FUNC; i++)
+		{
+			if(type->getFunction(i))
+				edges.push_back(make_pair(type->getFunction(i), type));
+		}
 
-						if(oper->getArgumentType(Operator::LEFT_ARG)==ptr_pgsqltype ||
-							 oper->getArgumentType(Operator::RIGHT_ARG)==ptr_pgsqltype)
-						{
-							refer=true;
-							refs.push_back(oper);
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_CAST)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						cast=dynamic_cast<Cast *>(*itr);
-						itr++;
+		for(i=0; i < 3; i++)
+		{
+			usr_type=getObjectPgSQLType(types[i]);
 
-						if(cast->getDataType(Cast::SRC_TYPE)==ptr_pgsqltype ||
-							 cast->getDataType(Cast::DST_TYPE)==ptr_pgsqltype)
-						{
-							refer=true;
-							refs.push_back(cast);
-						}
-					}
-				}
-			}
+			if(usr_type)
+				edges.push_back(make_pair(usr_type, type));
 		}
+	}
+	else if(obj_type==OBJ_DOMAIN)
+	{
+		usr_type=getObjectPgSQLType(dynamic_cast<Domain *>(object)->getType());
 
-		if(obj_type==OBJ_ROLE)
-		{
-			vector<BaseObject *> *obj_list=NULL;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType obj_types[13]={OBJ_FUNCTION, OBJ_TABLE, OBJ_DOMAIN,
-																OBJ_AGGREGATE, OBJ_SCHEMA, OBJ_OPERATOR,
-																OBJ_SEQUENCE, OBJ_CONVERSION,
-																OBJ_LANGUAGE, OBJ_TABLESPACE,
-																OBJ_TYPE, OBJ_OPFAMILY, OBJ_OPCLASS};
-			unsigned i,i1, count;
-			Role *role_aux=NULL;
-			Role *role=dynamic_cast<Role *>(object);
-			unsigned role_types[3]={Role::REF_ROLE, Role::MEMBER_ROLE, Role::ADMIN_ROLE};
-
-			//Check if the role is being referenced in other roles
-			itr=roles.begin();
-			itr_end=roles.end();
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				role_aux=dynamic_cast<Role *>(*itr);
-				itr++;
+		if(usr_type)
+			edges.push_back(make_pair(usr_type, object));
+	}
+	else if(obj_type==OBJ_LANGUAGE)
+	{
+		Language *lang=dynamic_cast<Language *>(object);
 
-				for(i1=0; i1 < 3 && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-				{
-					count=role_aux->getRoleCount(role_types[i1]);
-					for(i=0; i < count && !refer; i++)
-					{
-						if(role_aux->getRole(role_types[i1], i)==role)
-						{
-							refer=true;
-							refs.push_back(role_aux);
-						}
-					}
-				}
-			}
+		for(i=Language::VALIDATOR_FUNC; i <= Language::INLINE_FUNC; i++)
+		{
+			if(lang->getFunction(i))
+				edges.push_back(make_pair(lang->getFunction(i), lang));
+		}
+	}
+	else if(obj_type==OBJ_OPCLASS)
+	{
+		OperatorClass *op_class=dynamic_cast<OperatorClass *>(object);
 
-			for(i=0; i < 13 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
+		usr_type=getObjectPgSQLType(op_class->getDataType());
+		if(usr_type)
+			edges.push_back(make_pair(usr_type, op_class));
 
-				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-				{
-					if((*itr)->getOwner()==role)
-					{
-						refer=true;
-						refs.push_back(*itr);
-					}
-					itr++;
-				}
-			}
+		if(op_class->getFamily())
+			edges.push_back(make_pair(op_class->getFamily(), op_class));
 
-			//Special case: check if the role to be removed is the owner of the database
-			if((!exclusion_mode || (exclusion_mode && !refer)) && this->getOwner()==role)
-			{
-				refer=true;
-				refs.push_back(this);
-			}
+		count=op_class->getElementCount();
+		for(i=0; i < count; i++)
+		{
+			if(op_class->getElement(i).getOperator())
+				edges.push_back(make_pair(op_class->getElement(i).getOperator(), op_class));
 		}
+	}
+	else if(obj_type==OBJ_ROLE)
+	{
+		Role *role=dynamic_cast<Role *>(object);
+		unsigned role_types[3]={Role::REF_ROLE, Role::MEMBER_ROLE, Role::ADMIN_ROLE};
 
-		if(obj_type==OBJ_TABLESPACE)
+		for(i=0; i < 3; i++)
 		{
-			vector<BaseObject *>::iterator itr, itr_end;
-			unsigned i, count;
-			Table *tab=NULL;
-			Index *ind=NULL;
-			Constraint *rest=NULL;
+			count=role->getRoleCount(role_types[i]);
 
-			itr=tables.begin();
-			itr_end=tables.end();
+			for(i1=0; i1 < count; i1++)
+				edges.push_back(make_pair(role->getRole(role_types[i], i1), role));
+		}
+	}
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				tab=dynamic_cast<Table *>(*itr);
+	//Removes the duplicated edges (e.g. an object that references the same type twice)
+	std::sort(edges.begin(), edges.end());
+	edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+}
 
-				if(tab->getTablespace()==object)
-				{
-					refer=true;
-					refs.push_back(tab);
-				}
+void DatabaseModel::setReferenceEdges(BaseObject *object, bool remove)
+{
+	vector<pair<BaseObject *, BaseObject *> > edges;
+	vector<pair<BaseObject *, BaseObject *> >::iterator itr, itr_end;
+	vector<BaseObject *>::iterator itr_ref;
+	QHash<BaseObject *, vector<BaseObject *> >::iterator itr_refs;
 
-				count=tab->getIndexCount();
-				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-				{
-					ind=tab->getIndex(i);
-					if(ind->getTablespace()==object)
-					{
-						refer=true;
-						refs.push_back(ind);
-					}
-				}
+	//Removes the edges inserted by the object on the last update
+	edges=ref_edges.take(object);
+	itr=edges.begin();
+	itr_end=edges.end();
 
-				count=tab->getConstraintCount();
-				for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-				{
-					rest=tab->getConstraint(i);
-					if(rest->getTablespace()==object)
-					{
-						refer=true;
-						refs.push_back(rest);
-					}
-				}
+	while(itr!=itr_end)
+	{
+		itr_refs=obj_references.find(itr->first);
 
-				itr++;
-			}
+		if(itr_refs!=obj_references.end())
+		{
+			itr_ref=std::find(itr_refs.value().begin(), itr_refs.value().end(), itr->second);
+			if(itr_ref!=itr_refs.value().end())
+				itr_refs.value().erase(itr_ref);
 
-			if((!exclusion_mode || (exclusion_mode && !refer)) && this->BaseObject::getTablespace()==object)
-			{
-				refer=true;
-				refs.push_back(this);
-			}
+			if(itr_refs.value().empty())
+				obj_references.erase(itr_refs);
 		}
 
-		if(obj_type==OBJ_LANGUAGE)
-		{
-			vector<BaseObject *>::iterator itr, itr_end;
-			Function *func=NULL;
+		itr++;
+	}
 
-			itr=functions.begin();
-			itr_end=functions.end();
+	if(!remove)
+	{
+		edges.clear();
+		getReferenceEdges(object, edges);
+		itr=edges.begin();
+		itr_end=edges.end();
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				func=dynamic_cast<Function *>(*itr);
-				if(func->getLanguage()==object)
-				{
-					refer=true;
-					refs.push_back(func);
-				}
-				itr++;
-			}
+		while(itr!=itr_end)
+		{
+			obj_references[itr->first].push_back(itr->second);
+			itr++;
 		}
 
-		if(obj_type==OBJ_OPERATOR)
-		{
-			vector<BaseObject *> *obj_list=NULL;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType obj_types[3]={OBJ_OPCLASS,
-															 OBJ_AGGREGATE,
-															 OBJ_OPERATOR};
-			unsigned i, i1, count;
-			OperatorClass *op_class=NULL;
-			Operator *oper_aux=NULL, *oper=dynamic_cast<Operator *>(object);
-
-			for(i=0; i < 3 && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
+		ref_edges[object]=edges;
+	}
+}
 
-				if(obj_types[i]==OBJ_OPCLASS)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						op_class=dynamic_cast<OperatorClass *>(*itr);
-						itr++;
+void DatabaseModel::removeReferencesGraphEntries(BaseObject *object)
+{
+	ObjectType types[]={ OBJ_COLUMN, OBJ_CONSTRAINT, OBJ_TRIGGER, OBJ_INDEX, OBJ_RULE };
+	vector<BaseObject *> objs, refs;
+	vector<BaseObject *>::iterator itr, itr_end;
+	Table *table=dynamic_cast<Table *>(object);
+	TableObject *tab_obj=NULL;
+	unsigned i, i1, count;
 
-						count=op_class->getElementCount();
-						for(i1=0; i1 < count && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							if(op_class->getElement(i1).getOperator()==oper)
-							{
-								refer=true;
-								refs.push_back(op_class);
-							}
-						}
-					}
-				}
-				else if(obj_types[i]==OBJ_AGGREGATE)
-				{
-					while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-					{
-						if(dynamic_cast<Aggregate *>(*itr)->getSortOperator()==oper)
-						{
-							refer=true;
-							refs.push_back(*itr);
-						}
-						itr++;
-					}
-				}
-				else if(obj_types[i]==OBJ_OPERATOR)
-				{
-					while(itr!=itr_end && !refer)
-					{
-						oper_aux=dynamic_cast<Operator *>(*itr);
-						itr++;
+	QMutexLocker locker(&mod_mutex);
 
-						for(i1=Operator::OPER_COMMUTATOR; i1 <= Operator::OPER_GREATER &&
-								(!exclusion_mode || (exclusion_mode && !refer)); i1++)
-						{
-							if(oper_aux->getOperator(i1)==oper)
-							{
-								refer=true;
-								refs.push_back(oper_aux);
-							}
-						}
-					}
-				}
-			}
-		}
+	updateReferencesGraph();
+	setReferenceEdges(object, true);
 
-		if(obj_type==OBJ_OPFAMILY)
+	//The children of a removed table are removed from the graph as well
+	objs.push_back(object);
+	for(i=0; table && i < sizeof(types)/sizeof(ObjectType); i++)
+	{
+		count=table->getObjectCount(types[i]);
+		for(i1=0; i1 < count; i1++)
+			objs.push_back(table->getObject(i1, types[i]));
+	}
+
+	/* Removes the objects from the graph. The objects that still reference them have their
+		 edges recomputed on the next update so the graph keeps only the existing references */
+	for(i=0; i < objs.size(); i++)
+	{
+		refs=obj_references.take(objs[i]);
+		itr=refs.begin();
+		itr_end=refs.end();
+
+		while(itr!=itr_end)
 		{
-			vector<BaseObject *>::iterator itr, itr_end;
-			OperatorFamily *op_family=dynamic_cast<OperatorFamily *>(object);
+			tab_obj=dynamic_cast<TableObject *>(*itr);
 
-			itr=op_classes.begin();
-			itr_end=op_classes.end();
+			//The edges of the table objects are stored as edges of their parent tables
+			if(tab_obj && tab_obj->getParentTable())
+				objectModified(tab_obj->getParentTable(), REFS_MODIFIED);
+			else
+				objectModified(*itr, REFS_MODIFIED);
 
-			while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-			{
-				if(dynamic_cast<OperatorClass *>(*itr)->getFamily()==op_family)
-				{
-					refer=true;
-					refs.push_back(*itr);
-				}
-				itr++;
-			}
+			itr++;
 		}
+	}
 
-		if(obj_type==OBJ_COLUMN)
-		{
-			Column *column=dynamic_cast<Column *>(object);
-			vector<BaseObject *> *obj_list=NULL;
-			vector<BaseObject *>::iterator itr, itr_end;
-			ObjectType  obj_types[]={ OBJ_SEQUENCE, OBJ_VIEW, OBJ_TABLE, OBJ_RELATIONSHIP };
-			unsigned i, count=4;
+	outdated_refs.remove(object);
+}
 
-			for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !refer)); i++)
-			{
-				obj_list=getObjectList(obj_types[i]);
-				itr=obj_list->begin();
-				itr_end=obj_list->end();
+void DatabaseModel::updateReferencesGraph(void)
+{
+	QMutexLocker locker(&mod_mutex);
+	QSet<BaseObject *> objs=outdated_refs;
+	QSet<BaseObject *>::iterator itr;
 
-				while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !refer)))
-				{
-					if((obj_types[i]==OBJ_SEQUENCE && dynamic_cast<Sequence *>(*itr)->getOwnerColumn()==column) ||
-						 (obj_types[i]==OBJ_VIEW && dynamic_cast<View *>(*itr)->isReferencingColumn(column)))
-					{
-						refer=true;
-						refs.push_back(*itr);
-					}
-					else if(obj_types[i]==OBJ_TABLE)
-					{
-						Table *tab=dynamic_cast<Table *>(*itr);
-						unsigned trig_cnt, constr_cnt, idx, count1, i1;
-						Trigger *trig=NULL;
+	outdated_refs.clear();
 
-						constr_cnt=tab->getConstraintCount();
-						for(idx=0; idx < constr_cnt && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
-						{
-							if(tab->getConstraint(idx)->isColumnExists(column, Constraint::SOURCE_COLS) ||
-								 tab->getConstraint(idx)->isColumnExists(column, Constraint::REFERENCED_COLS))
-							{
-								refer=true;
-								refs.push_back(tab->getConstraint(idx));
-							}
-						}
+	for(itr=objs.begin(); itr!=objs.end(); itr++)
+		setReferenceEdges(*itr);
+}
 
-						trig_cnt=tab->getTriggerCount();
-						for(idx=0; idx < trig_cnt && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
-						{
-							trig=tab->getTrigger(idx);
-							count1=trig->getColumnCount();
+void DatabaseModel::setReferencesModified(void)
+{
+	BaseObject::setReferencesModified();
+	objectModified(this, REFS_MODIFIED);
+}
 
-							for(i1=0; i1 < count1 && (!exclusion_mode || (exclusion_mode && !refer)); i1++)
-							{
-								if(trig->getColumn(i1)==column)
-								{
-									refer=true;
-									refs.push_back(trig);
-								}
-							}
-						}
-					}
-					else if(obj_types[i]==OBJ_RELATIONSHIP)
-					{
-						Relationship *rel=dynamic_cast<Relationship *>(*itr);
-						unsigned constr_cnt, idx;
+void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclusion_mode)
+{
+	refs.clear();
 
-						constr_cnt=rel->getConstraintCount();
-						for(idx=0; idx < constr_cnt && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
-						{
-							if(rel->getConstraint(idx)->isColumnExists(column, Constraint::SOURCE_COLS) ||
-								 rel->getConstraint(idx)->isColumnExists(column, Constraint::REFERENCED_COLS))
-							{
-								refer=true;
-								refs.push_back(rel);
-							}
-						}
-					}
+	if(object)
+	{
+		updateReferencesGraph();
 
-					itr++;
-				}
-			}
+		if(obj_references.contains(object))
+		{
+			//In exclusion mode only the first reference is returned since it's enough to deny the object removal
+			if(exclusion_mode)
+				refs.push_back(obj_references[object].front());
+			else
+				refs=obj_references[object];
 		}
 	}
 }
@@ -6860,7 +7655,9 @@ BaseObject *DatabaseModel::getObjectPgSQLType(PgSQLType type)
 
 void DatabaseModel::validateSchemaRenaming(Schema *schema, const QString &prev_sch_name)
 {
-	ObjectType types[]={ OBJ_TABLE, OBJ_VIEW, OBJ_DOMAIN, OBJ_TYPE, OBJ_SEQUENCE };
+	ObjectType types[]={ OBJ_TABLE, OBJ_VIEW, OBJ_DOMAIN, OBJ_TYPE, OBJ_SEQUENCE,
+											 OBJ_FUNCTION, OBJ_AGGREGATE, OBJ_OPERATOR, OBJ_CONVERSION,
+											 OBJ_OPCLASS, OBJ_OPFAMILY };
 	vector<BaseObject *> list, vet;
 	BaseObject *obj=NULL;
 	QString prev_name;
@@ -6870,10 +7667,17 @@ void DatabaseModel::validateSchemaRenaming(Schema *schema, const QString &prev_s
 		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	//Get all the objects on the informed schema
-	for(unsigned i=0; i < 5; i++)
+	for(unsigned i=0; i < 11; i++)
 	{
 		vet=getObjects(types[i], schema);
-		list.insert(list.end(), vet.begin(), vet.end());
+
+		//Updates the cached qualified names of the objects since they contain the schema name
+		for(unsigned i1=0; i1 < vet.size(); i1++)
+			vet[i1]->updateFormattedName();
+
+		//Only the first five types have user defined types that must be renamed
+		if(i < 5)
+			list.insert(list.end(), vet.begin(), vet.end());
 	}
 
 	while(!list.empty())
@@ -28,7 +28,14 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #define DATABASE_MODEL_H
 
 #include <QFile>
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QHash>
+#include <QSet>
+#include <QMultiHash>
+#include <QMutex>
 #include <QObject>
+#include <QThread>
 #include "baseobject.h"
 #include "table.h"
 #include "function.h"
@@ -50,12 +57,110 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include "domain.h"
 #include <algorithm>
 #include <locale.h>
+#include <QtConcurrentMap>
+
+/*! \brief Stores an object which code definition is generated by DatabaseModel::getCodeDefinition()
+ as well the generated code or the error raised during the generation. Jobs are processed by worker threads
+ and their results are joined in the same order they were created */
+class CodeGenJob {
+	protected:
+		//! \brief Object which code must be generated
+		BaseObject *object;
+
+		//! \brief Code definition type (SQL or XML)
+		unsigned def_type;
+
+		//! \brief Code generated for the object
+		QString code_def;
+
+		//! \brief Indicates if the generation raised an error (stored on 'error')
+		bool error_raised;
+
+		Exception error;
+
+	public:
+		CodeGenJob(void)
+		{ object=NULL; def_type=SchemaParser::SQL_DEFINITION; error_raised=false; }
+
+		friend class DatabaseModel;
+};
+
+/*! \brief Stores a set of relationships that must be connected in the same order they are stored as well
+ the relationships that couldn't be connected and the errors raised by them. Each job holds the relationships
+ of a group of tables that isn't linked to the tables of another job so the jobs can be processed by worker threads */
+class RelConnectionJob {
+	protected:
+		//! \brief Relationships to be connected
+		vector<Relationship *> relationships;
+
+		//! \brief Relationships which connection failed (the error is stored at the same position on 'errors')
+		vector<Relationship *> failed_rels;
+
+		vector<Exception> errors;
+
+		//! \brief Thread to which the objects created by the connection (e.g. n-n tables) are moved
+		QThread *thread;
+
+		/*! \brief Range of object ids reserved for the objects created by the connection (see BaseObject::reserveObjectIds()).
+		 A zero count makes the objects receive ids from the global counter */
+		unsigned first_id, id_count;
+
+		/*! \brief Indicates that the connection created more objects than the reserved range could hold, so part of
+		 the ids came from the global counter and the job must be connected again serially */
+		bool ids_exhausted;
+
+	public:
+		RelConnectionJob(void)
+		{ thread=NULL; first_id=id_count=0; ids_exhausted=false; }
+
+		friend class DatabaseModel;
+};
+
+/*! \brief Stores a special object (see DatabaseModel::storeSpecialObjectsXML()) detached from the model while
+ the relationships are reconnected. Constraints, triggers, indexes and sequences are kept in memory with the names
+ of the columns they reference so they can be rebound to the columns recreated by the relationships. The other
+ objects (views and the relationships linking them to tables) are stored as XML code */
+class SpecialObjectSnapshot {
+	protected:
+		//! \brief Detached object (NULL when the object is stored as XML code)
+		BaseObject *object;
+
+		//! \brief Table that owns the object (table objects) or the table of the owner column (sequences)
+		Table *table;
+
+		/*! \brief Names of the columns referenced by the object: constraint source columns, trigger columns,
+		 index elements columns (empty name for expression elements) or the sequence owner column */
+		vector<QString> columns;
+
+		//! \brief Names of the columns referenced by a foreign key on the referenced table
+		vector<QString> ref_columns;
+
+		//! \brief Index elements which columns are rebound using the stored names
+		vector<IndexElement> elements;
+
+		//! \brief XML definition of the object when it isn't stored in memory
+		QString xml_def;
+
+	public:
+		SpecialObjectSnapshot(void)
+		{ object=NULL; table=NULL; }
+
+		friend class DatabaseModel;
+};
 
 class DatabaseModel:  public QObject, public BaseObject {
 	private:
 		Q_OBJECT
 
-		static unsigned dbmodel_id;
+		static QAtomicInt dbmodel_id;
+
+		/*! \brief Maximum number of objects which code is generated (in parallel) and kept in memory
+		 before being written by writeCodeDefinition() */
+		static const unsigned CODE_GEN_BATCH_SIZE=500;
+
+		/*! \brief Amount of object ids reserved for each relationship connected by a worker thread besides the
+		 ids reserved for the columns and constraints of the linked tables (see validateRelationships()) */
+		static const unsigned REL_RESERVED_IDS=16;
 
 		//! \brief Database encoding
 		EncodingType encoding;
@@ -92,26 +197,163 @@ class DatabaseModel:  public QObject, public BaseObject {
 		vector<BaseObject *> sequences;
 		vector<BaseObject *> permissions;
 
-		/*! \brief Stores the xml definition for special objects. This map is used
-		 when revalidating the relationships */
-		map<unsigned, QString> xml_special_objs;
+		/*! \brief User defined types (tables, sequences, domains and base types) of the model. The registry is
+		 used by PgSQLType to resolve the types names and references */
+		UserTypeRegistry user_types;
+
+		/*! \brief Stores the special objects (detached or as xml definition) by their ids.
+		 This map is used when revalidating the relationships */
+		map<unsigned, SpecialObjectSnapshot> special_objs;
 
 		//! \brief Indicates if the model is being loaded
 		bool loading_model;
 
+		/*! \brief Indexes the objects of each type by their formatted names (getName(true)) or signatures (functions
+		 and operators) in order to avoid sequential searches on the objects lists. Permissions are handled apart
+		 so they aren't stored on these indexes. In case of duplicated keys (e.g. an object renamed to the name of
+		 another one before the validation) the object placed first on the objects list is returned */
+		QMultiHash<QString, BaseObject *> name_index[BaseObject::OBJECT_TYPE_COUNT];
+
+		//! \brief Key of each object on the name indexes, used to remove the old entry when the object is renamed
+		QHash<BaseObject *, QString> name_keys;
+
+		/*! \brief Objects renamed since the last update of the name indexes (see objectModified()).
+		 Only the entries of these objects are updated by updateNameIndex() */
+		QSet<BaseObject *> renamed_objs;
+
+		/*! \brief Positions of the objects on their lists. Inserting or removing an object shifts the following
+		 ones so only the positions lower than valid_positions[obj_type] are up to date, the others are
+		 recomputed on demand by getObjectPosition() */
+		QHash<BaseObject *, unsigned> obj_positions;
+		unsigned valid_positions[BaseObject::OBJECT_TYPE_COUNT];
+
+		/*! \brief Serializes the modifications notified by the objects of the model since they can
+		 be changed by worker threads (see validateRelationships()) */
+		QMutex mod_mutex;
+
+		//! \brief Returns whether the objects of the passed type are stored on the name indexes
+		bool isNameIndexed(ObjectType obj_type);
+
+		//! \brief Returns the key of the passed object on the name indexes (formatted name or signature)
+		QString getNameIndexKey(BaseObject *object);
+
+		//! \brief Inserts (or removes) the passed object on the name indexes replacing its previous key
+		void setNameIndexEntry(BaseObject *object, bool remove=false);
+
+		/*! \brief Updates the keys of the objects renamed since the last update. The objects of a renamed
+		 schema and the operators (which signatures contain the names of user defined types) are updated too */
+		void updateNameIndex(void);
+
+		//! \brief Returns the position of the object on its list or -1 when the object isn't on the model
+		int getObjectPosition(BaseObject *object);
+
+		//! \brief Registers the modifications of the model's objects in order to update their entries on the indexes
+		void objectModified(BaseObject *object, unsigned mod_type);
+
+		//! \brief Returns an object searching it on the name indexes by its name or signature (functions and operators)
+		BaseObject *getIndexedObject(const QString &name, ObjectType obj_type);
+
+		/*! \brief Stores the references graph of the model: each referenced object is associated to the objects that
+		 reference it (the ones returned by getObjectReferences()). The graph is updated when objects are added to or removed
+		 from the model and when the references of an object change (see objectModified()) */
+		QHash<BaseObject *, vector<BaseObject *> > obj_references;
+
+		/*! \brief Edges inserted on the references graph by each object of the model (tables include
+		 the edges of their children). Used to remove the old edges when the object changes */
+		QHash<BaseObject *, vector<pair<BaseObject *, BaseObject *> > > ref_edges;
+
+		/*! \brief Objects which references changed since the last update of the references graph.
+		 Only the edges of these objects are updated by updateReferencesGraph() */
+		QSet<BaseObject *> outdated_refs;
+
+		/*! \brief Returns the edges (referenced object, referrer object) of the references graph created by the
+		 passed object. When the object is a table the edges created by its children are returned too */
+		void getReferenceEdges(BaseObject *object, vector<pair<BaseObject *, BaseObject *> > &edges);
+
+		//! \brief Inserts (or removes) the edges created by the passed object on the references graph replacing its old edges
+		void setReferenceEdges(BaseObject *object, bool remove=false);
+
+		//! \brief Updates the edges of the objects which references changed since the last update
+		void updateReferencesGraph(void);
+
+		/*! \brief Removes the edges created by the passed object and the edges to it from the references graph. The
+		 objects that referenced it are marked as outdated. Used when the object is removed from the model */
+		void removeReferencesGraphEntries(BaseObject *object);
+
+		//! \brief Registers the modification of the model's own references (owner, tablespace)
+		void setReferencesModified(void);
+
+		/*! \brief Discards the cached code of the objects that reference (directly or not) the objects
+		 renamed since the last code generation of the passed definition type */
+		void invalidateReferrersCode(unsigned def_type);
+
+		/*! \brief Parser used to read the model file and the xml buffers that generates objects. Each model has
+		 its own parser so different models can be loaded at the same time */
+		XMLParser xmlparser;
+
 		/*! \brief Returns an object seaching it by its name and type. The third parameter stores
 		 the object index */
 		BaseObject *getObject(const QString &name, ObjectType obj_type, int &obj_idx);
 
+		/*! \brief Searches the dependencies of the passed object storing the objects already visited on the
+		 'visited' set. The 'is_root' parameter indicates that the object was passed to getObjectDependecies() */
+		void __getObjectDependecies(BaseObject *object, vector<BaseObject *> &deps, bool inc_indirect_deps,
+																QSet<BaseObject *> &visited, bool is_root=false);
+
 		//! \brief Generic method that adds an object to the model
 		void __addObject(BaseObject *object, int obj_idx=-1);
 
 		//! \brief Generic method that removes an object to the model
 		void __removeObject(BaseObject *object, int obj_idx=-1);
 
+		//! \brief Creates the object represented by the current element of the XML parser adding it to the model
+		void loadObject(ObjectType obj_type, int progress);
+
+		/*! \brief Loads the model file used by loadModel() and loadModelStream(). Both share the header, database
+		 attributes, deferred objects and error handling, differing only in how the elements are iterated */
+		void __loadModel(const QString &filename, bool trust_checksum, bool use_stream);
+
+		//! \brief Returns the loading progress of the current element either from the stream or the document buffer
+		int getLoadingProgress(bool use_stream);
+
+		/*! \brief Recreates from their xml code the objects which creation was deferred by loadModelStream()
+		 because they reference objects that were not created yet */
+		void loadDeferredObjects(deque<QString> &xml_defs);
+
+		/*! \brief Recreates from their elements the objects which creation was deferred by loadModel()
+		 because they reference objects that were not created yet */
+		void loadDeferredObjects(deque<const xmlNode *> &elems);
+
 		//! \brief Recreates the special object from the passed xml code buffer
 		void createSpecialObject(const QString &xml_def, unsigned obj_id=0);
 
+		/*! \brief Generates the code definition of the object stored by the passed job. This method is
+		 called in parallel by DatabaseModel::getCodeDefinition() so errors are stored on the job instead of raised */
+		static void generateCodeDefinition(CodeGenJob *job);
+
+		/*! \brief Connects the relationships of the passed job in order. This method is called in parallel by
+		 DatabaseModel::validateRelationships() so errors are stored on the job instead of raised */
+		static void connectRelationships(RelConnectionJob &job);
+
+		/*! \brief Detaches the passed special object (constraint, trigger, index or sequence) from the model
+		 storing it on the special objects map with the names of the columns it references */
+		void storeSpecialObject(BaseObject *object);
+
+		/*! \brief Recreates the special object stored by the snapshot. Detached objects are rebound to
+		 the current columns and reinserted on the model, the others are created from their xml definition */
+		void createSpecialObject(SpecialObjectSnapshot &snapshot, unsigned obj_id);
+
+		/*! \brief Recreates all the stored special objects clearing the special objects map. Returns true when
+		 some object was created from its xml definition (the xml parser's document is replaced in that case) */
+		bool createSpecialObjects(void);
+
+		//! \brief Clears the special objects map destroying the objects that were not reinserted on the model
+		void clearSpecialObjects(void);
+
+		/*! \brief Writes the passed code on the output device raising an error if the writing fails.
+		 The written data is added to the checksum when it is specified */
+		static void writeCode(QIODevice *output, const QString &code, QCryptographicHash *checksum=NULL);
+
 		//! \brief Removes an user defined type (domain or type)
 		void removeUserType(BaseObject *object, int obj_idx);
 
@@ -120,18 +362,24 @@ class DatabaseModel:  public QObject, public BaseObject {
 		BaseObject *getObjectPgSQLType(PgSQLType type);
 
 	public:
+		//! \brief Size (in bytes) from which model files should be loaded through loadModelStream()
+		static const unsigned STREAM_LOAD_MIN_SIZE=8388608;
+
 		DatabaseModel(void);
 		~DatabaseModel(void);
 
 		//! \brief Returns the complete object list according to the type
 		vector<BaseObject *> *getObjectList(ObjectType obj_type);
 
-		//! \brief Disconnects all the relationships in a ordered way
-		void disconnectRelationships(void);
+		/*! \brief Disconnects all the relationships in a ordered way. When a relationship set is
+		 specified only the relationships in it are disconnected */
+		void disconnectRelationships(QSet<BaseObject *> *rels=NULL);
 
-		/*! \brief Detects and stores the XML for special objects (that is referencing columns created
-		 by relationship) in order to be reconstructed in a posterior moment */
-		void storeSpecialObjectsXML(void);
+		/*! \brief Detects and stores the special objects (that is referencing columns created by relationship)
+		 in order to be reconstructed in a posterior moment. Constraints, triggers, indexes and sequences are kept
+		 in memory and the other objects are stored as XML. When a table set is specified only the special objects
+		 referencing columns added by relationship on those tables are stored */
+		void storeSpecialObjectsXML(QSet<BaseObject *> *tabs=NULL);
 
 		//! \brief Validates all the relationship, propagating all column modifications over the tables
 		void validateRelationships(void);
@@ -160,8 +408,18 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns an object from the model using its index and type
 		BaseObject *getObject(unsigned obj_idx, ObjectType obj_type);
 
-		//! \brief Loads a database model from a file
-		void loadModel(const QString &filename);
+		/*! \brief Returns the XML parser used by the model. Buffers that must be converted into objects
+		 through the create*() methods must be loaded by this parser */
+		XMLParser *getXMLParser(void);
+
+		/*! \brief Loads a database model from a file. When trust_checksum is true the file isn't validated
+		 against the DTD if its checksum is valid (see XMLParser::setTrustChecksum()) */
+		void loadModel(const QString &filename, bool trust_checksum=false);
+
+		/*! \brief Loads a database model from a file reading its elements one at a time (see XMLParser::openXMLStream())
+		 instead of building the whole element tree first. Each object is created as soon as its element is read and
+		 the ones referencing objects not yet created are deferred and recreated later from their xml code */
+		void loadModelStream(const QString &filename, bool trust_checksum=false);
 
 		//! \brief Sets the database encoding
 		void setEncoding(EncodingType encod);
@@ -216,6 +474,11 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns the complete SQL/XML definition for the entire model (including all the other objects).
 		QString getCodeDefinition(unsigned def_type);
 
+		/*! \brief Writes the complete SQL/XML definition for the entire model on the output device (e.g. a file or a socket).
+		 The code of the objects is written as soon as it is generated instead of being stored in memory until the end
+		 of the generation. The parameter 'export_file' has the same meaning as in getCodeDefinition(unsigned, bool) */
+		void writeCodeDefinition(unsigned def_type, QIODevice *output, bool export_file=true);
+
 		//! \brief Returns the code definition only for the database (excluding the definition of the other objects)
 		QString __getCodeDefinition(unsigned def_type);
 
@@ -353,6 +616,15 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Validates the relationship to reflect the modifications on the column/constraint of the passed table
 		void validateRelationships(TableObject *object, Table *parent_tab);
 
+		/*! \brief Validates the invalidated relationships and the ones reached from them (or from the passed tables)
+		 through the relationship graph. Only those relationships and the special objects referencing columns
+		 of the affected tables are disconnected and reconnected. The passed set is cleared after the first use */
+		void validateRelationships(QSet<BaseObject *> &tables);
+
+		/*! \brief Returns if the special object (constraint, trigger, index, sequence or view)
+		 references some of the passed columns */
+		bool isReferencingColumns(BaseObject *object, QSet<BaseObject *> &columns);
+
 		/*! \brief Checks if from the passed relationship some redundacy is found. Redundancy generates infinite column
 		 propagation over the tables. This method raises an error when found some. */
 		void checkRelationshipRedundancy(Relationship *rel);
@@ -362,9 +634,13 @@ class DatabaseModel:  public QObject, public BaseObject {
 		 the informed object, e.g., a schema linked to a table that is referenced in a view */
 		void getObjectDependecies(BaseObject *objeto, vector<BaseObject *> &vet_deps, bool inc_indirect_deps=false);
 
-		/*! \brief Returns all the objects that references the passed object. The boolean paramenter is used to performance purpose,
-		 generally applied when excluding objects, this means that the method will stop the search when the first
-		 reference is found */
+		/*! \brief Returns all the objects that the passed objects depend on. The dependencies of all objects are
+		 searched in a single traversal so the objects shared by them are visited only once */
+		void getObjectDependecies(vector<BaseObject *> &objs, vector<BaseObject *> &deps, bool inc_indirect_deps=false);
+
+		/*! \brief Returns all the objects that references the passed object searching them on the references graph.
+		 The boolean paramenter is used to performance purpose, generally applied when excluding objects, this means
+		 that only the first reference found is returned */
 		void getObjectReferences(BaseObject *object, vector<BaseObject *> &refs, bool exclusion_mode=false);
 
 		//! \brief Marks all the graphical objects as modified forcing their redraw
@@ -46,26 +46,32 @@ void Domain::setConstraintName(const QString &constr_name)
 		throw Exception(ERR_ASG_INV_NAME_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->constraint_name=constr_name;
+	setCodeInvalidated();
 }
 
 void Domain::setExpression(const QString &expr)
 {
 	this->expression=expr;
+	setCodeInvalidated();
 }
 
 void Domain::setDefaultValue(const QString &default_val)
 {
 	this->default_value=default_val;
+	setCodeInvalidated();
 }
 
 void Domain::setNotNull(bool value)
 {
 	not_null=value;
+	setCodeInvalidated();
 }
 
 void Domain::setType(PgSQLType type)
 {
 	this->type=type;
+
+	setReferencesModified();
 }
 
 QString Domain::getConstraintName(void)
@@ -34,6 +34,7 @@ bool Parameter::isOut(void)
 void Parameter::operator = (const Parameter &param)
 {
 	this->obj_name=param.obj_name;
+	updateFormattedName();
 	this->type=param.type;
 	this->default_value=param.default_value;
 	this->is_in=param.is_in;
@@ -55,11 +56,11 @@ QString Parameter::getCodeDefinition(unsigned def_type)
 	return(BaseObject::__getCodeDefinition(def_type));
 }
 
-unsigned Function::function_id=40000;
+QAtomicInt Function::function_id(40000);
 
 Function::Function(void)
 {
-	object_id=Function::function_id++;
+	object_id=Function::function_id.fetchAndAddOrdered(1);
 	return_type=PgSQLType("void");
 	language=NULL;
 	returns_setof=false;
@@ -127,6 +128,7 @@ void Function::addParameter(Parameter param)
 	parameters.push_back(param);
 
 	createSignature();
+	setReferencesModified();
 }
 
 void Function::addReturnedTableColumn(const QString &name, PgSQLType type)
@@ -161,6 +163,7 @@ void Function::addReturnedTableColumn(const QString &name, PgSQLType type)
 	p.setName(name);
 	p.setType(type);
 	ret_table_columns.push_back(p);
+	setCodeInvalidated();
 }
 
 void Function::setParametersAttribute(unsigned def_type)
@@ -200,11 +203,13 @@ void Function::setTableReturnTypeAttribute(unsigned def_type)
 void Function::setExecutionCost(unsigned exec_cost)
 {
 	execution_cost=exec_cost;
+	setCodeInvalidated();
 }
 
 void Function::setRowAmount(unsigned row_amount)
 {
 	this->row_amount=row_amount;
+	setCodeInvalidated();
 }
 
 void Function::setLibrary(const QString &library)
@@ -215,6 +220,7 @@ void Function::setLibrary(const QString &library)
 										ERR_ASG_FUNC_REFLIB_LANG_NOT_C,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->library=library;
+	setCodeInvalidated();
 }
 
 void Function::setSymbol(const QString &symbol)
@@ -225,16 +231,20 @@ void Function::setSymbol(const QString &symbol)
 										ERR_ASG_FUNC_REFLIB_LANG_NOT_C,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->symbol=symbol;
+	setCodeInvalidated();
 }
 
 void Function::setReturnType(PgSQLType type)
 {
 	return_type=type;
+
+	setReferencesModified();
 }
 
 void Function::setFunctionType(FunctionType func_type)
 {
 	function_type=func_type;
+	setCodeInvalidated();
 }
 
 void Function::setLanguage(BaseObject *language)
@@ -247,26 +257,32 @@ void Function::setLanguage(BaseObject *language)
 		throw Exception(ERR_ASG_INV_LANGUAGE_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->language=language;
+
+	setReferencesModified();
 }
 
 void Function::setReturnSetOf(bool value)
 {
 	returns_setof=value;
+	setCodeInvalidated();
 }
 
 void Function::setWindowFunction(bool value)
 {
 	is_wnd_function=value;
+	setCodeInvalidated();
 }
 
 void Function::setSecurityType(SecurityType sec_type)
 {
 	security_type=sec_type;
+	setCodeInvalidated();
 }
 
 void Function::setBehaviorType(BehaviorType behav_type)
 {
 	behavior_type=behav_type;
+	setCodeInvalidated();
 }
 
 void Function::setSourceCode(const QString &src_code)
@@ -277,6 +293,7 @@ void Function::setSourceCode(const QString &src_code)
 										ERR_ASG_CODE_FUNC_C_LANGUAGE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->source_code=src_code;
+	setCodeInvalidated();
 }
 
 PgSQLType Function::getReturnType(void)
@@ -376,11 +393,14 @@ void Function::removeParameters(void)
 {
 	parameters.clear();
 	createSignature();
+
+	setReferencesModified();
 }
 
 void Function::removeReturnedTableColumns(void)
 {
 	ret_table_columns.clear();
+	setCodeInvalidated();
 }
 
 void Function::removeParameter(const QString &name, PgSQLType type)
@@ -403,6 +423,7 @@ void Function::removeParameter(const QString &name, PgSQLType type)
 
 	//After remove the parameter is necessary updated the signature
 	createSignature();
+	setReferencesModified();
 }
 
 void Function::removeParameter(unsigned param_idx)
@@ -416,6 +437,8 @@ void Function::removeParameter(unsigned param_idx)
 	parameters.erase(itr);
 
 	createSignature();
+
+	setReferencesModified();
 }
 
 void Function::removeReturnedTableColumn(unsigned column_idx)
@@ -426,30 +449,44 @@ void Function::removeReturnedTableColumn(unsigned column_idx)
 	vector<Parameter>::iterator itr;
 	itr=ret_table_columns.begin()+column_idx;
 	ret_table_columns.erase(itr);
+	setCodeInvalidated();
 }
 
-QString Function::getSignature(void)
+QString Function::getSignature(bool format)
 {
-	return(signature);
+	if(format)
+		return(signature);
+	else
+		return(__getSignature(false));
 }
 
-void Function::createSignature(bool format)
+QString Function::__getSignature(bool format)
 {
-	Parameter param;
 	QString str_param;
 	unsigned i, count;
 
 	count=parameters.size();
 	for(i=0; i < count; i++)
 	{
-		param=parameters[i];
-		str_param+=(*param.getType());
-
+		str_param+=(*parameters[i].getType());
 		if(i < (count-1)) str_param+=",";
 	}
 
 	//Signature format NAME(PARAM1_TYPE,PARAM2_TYPE,...,PARAMn_TYPE)
-	signature=this->getName(format) + QString("(") + str_param + QString(")");
+	return(this->getName(format) + QString("(") + str_param + QString(")"));
+}
+
+void Function::createSignature(bool format)
+{
+	QString new_signature=__getSignature(format);
+
+	/* The signature is the key of the function on the model's index so it is
+		 updated only when the signature really changes */
+	if(new_signature!=signature)
+	{
+		signature=new_signature;
+		setNameModified();
+	}
 }
 
 QString Function::getCodeDefinition(unsigned def_type)
@@ -472,7 +509,7 @@ QString Function::getCodeDefinition(unsigned def_type, bool reduced_form)
 	}
 	else
 	{
-		attributes[ParsersAttributes::LANGUAGE]=language->getCodeDefinition(def_type,true);
+		attributes[ParsersAttributes::LANGUAGE]=getReferenceCodeDefinition(language, def_type);
 		attributes[ParsersAttributes::RETURN_TYPE]=return_type.getCodeDefinition(def_type);
 	}
 
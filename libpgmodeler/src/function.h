@@ -56,7 +56,7 @@ class Parameter: public Column {
 
 class Function: public BaseObject {
 	private:
-		static unsigned function_id;
+		static QAtomicInt function_id;
 
 		//! \brief Function unique signature
 		QString signature;
@@ -111,6 +111,9 @@ class Function: public BaseObject {
 		//! \brief Formats the function return type to be used by the SchemaParser
 		void setTableReturnTypeAttribute(unsigned def_type);
 
+		//! \brief Builds the function signature formatting (or not) the names
+		QString __getSignature(bool format);
+
 	public:
 		Function(void);
 
@@ -228,8 +231,9 @@ class Function: public BaseObject {
 		//! \brief Removes all the columns from returned table column
 		void removeReturnedTableColumns(void);
 
-		//! \brief Returns the complete function signature
-		QString getSignature(void);
+		/*! \brief Returns the complete function signature. When 'format' is false an
+		 unformatted signature is built without changing the stored one */
+		QString getSignature(bool format=true);
 
 		/*! \brief Generates the function's signature. The 'format' parameter is used
 		 to adequately format the function and parameters names. By default
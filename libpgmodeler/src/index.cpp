@@ -101,6 +101,8 @@ void Index::addElement(const QString &expr, OperatorClass *op_class, bool asc_or
 
 		elements.push_back(elem);
 	}
+
+	setReferencesModified();
 }
 
 void Index::addElement(Column *column, OperatorClass *op_class, bool asc_order, bool nulls_first)
@@ -129,6 +131,8 @@ void Index::addElement(Column *column, OperatorClass *op_class, bool asc_order,
 
 		elements.push_back(elem);
 	}
+
+	setReferencesModified();
 }
 
 void Index::removeElement(unsigned idx_elem)
@@ -138,11 +142,13 @@ void Index::removeElement(unsigned idx_elem)
 		throw Exception(ERR_REF_ELEM_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	elements.erase(elements.begin() + idx_elem);
+	setReferencesModified();
 }
 
 void Index::removeElements(void)
 {
 	elements.clear();
+	setReferencesModified();
 }
 
 void Index::setIndexAttribute(unsigned attrib_id, bool value)
@@ -151,21 +157,25 @@ void Index::setIndexAttribute(unsigned attrib_id, bool value)
 		throw Exception(ERR_REF_ATTRIB_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	index_attribs[attrib_id]=value;
+	setCodeInvalidated();
 }
 
 void Index::setFillFactor(unsigned factor)
 {
 	fill_factor=factor;
+	setCodeInvalidated();
 }
 
 void Index::setIndexingType(IndexingType idx_type)
 {
 	this->indexing_type=idx_type;
+	setCodeInvalidated();
 }
 
 void Index::setConditionalExpression(const QString &expr)
 {
 	conditional_expr=expr;
+	setCodeInvalidated();
 }
 
 unsigned Index::getFillFactor(void)
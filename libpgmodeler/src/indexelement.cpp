@@ -83,7 +83,7 @@ QString IndexElement::getCodeDefinition(unsigned def_type)
 		if(def_type==SchemaParser::SQL_DEFINITION)
 			attributes[ParsersAttributes::OP_CLASS]=operator_class->getName(true);
 		else
-			attributes[ParsersAttributes::OP_CLASS]=operator_class->getCodeDefinition(def_type, true);
+			attributes[ParsersAttributes::OP_CLASS]=BaseObject::getReferenceCodeDefinition(operator_class, def_type);
 	}
 
 	return(SchemaParser::getCodeDefinition(ParsersAttributes::INDEX_ELEMENT,attributes, def_type));
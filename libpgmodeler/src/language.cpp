@@ -29,6 +29,7 @@ void Language::setName(const QString &name)
 void Language::setTrusted(bool value)
 {
 	is_trusted=value;
+	setCodeInvalidated();
 }
 
 void  Language::setFunction(Function *func, unsigned func_type)
@@ -70,6 +71,8 @@ void  Language::setFunction(Function *func, unsigned func_type)
 	else
 		//Raises an error in case the function has invalid parameters (count and types)
 		throw Exception(ERR_ASG_FUNCTION_INV_PARAMS,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	setReferencesModified();
 }
 
 Function * Language::getFunction(unsigned func_type)
@@ -110,8 +113,7 @@ QString Language::getCodeDefinition(unsigned def_type, bool reduced_form)
 				attributes[attribs_func[i]]=functions[i]->getName(true);
 			else
 			{
-				functions[i]->setAttribute(ParsersAttributes::REF_TYPE, attribs_func[i]);
-				attributes[attribs_func[i]]=functions[i]->getCodeDefinition(def_type, true);
+				attributes[attribs_func[i]]=getReferenceCodeDefinition(functions[i], def_type, attribs_func[i]);
 			}
 		}
 	}
@@ -740,8 +740,8 @@ void OperationList::executeOperation(Operation *oper, bool redo)
 				 oper->op_type==Operation::OBJECT_MOVED)))
 		{
 			//Resets the XML parser and loads the buffer xml from the operation
-			XMLParser::restartParser();
-			XMLParser::loadXMLBuffer(oper->xml_definition);
+			model->getXMLParser()->restartParser();
+			model->getXMLParser()->loadXMLBuffer(oper->xml_definition);
 
 			if(obj_type==OBJ_TRIGGER)
 				aux_obj=model->createTrigger(parent_tab);
@@ -74,7 +74,10 @@ void Operator::setName(const QString &name)
 		if(!isValidName(name))
 			throw Exception(ERR_ASG_INV_NAME_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		else
+		{
 			this->obj_name=name;
+			setNameModified();
+		}
 	}
 }
 
@@ -134,6 +137,8 @@ void Operator::setFunction(Function *func, unsigned func_type)
 	}
 
 	functions[func_type]=func;
+
+	setReferencesModified();
 }
 
 void Operator::setArgumentType(PgSQLType arg_type, unsigned arg_id)
@@ -143,6 +148,10 @@ void Operator::setArgumentType(PgSQLType arg_type, unsigned arg_id)
 		throw Exception( ERR_REF_OPER_ARG_INV_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	argument_types[arg_id]=arg_type;
+
+	//The argument types are part of the signature which is the key of the operator on the model's index
+	setNameModified();
+	setReferencesModified();
 }
 
 void Operator::setOperator(Operator *oper, unsigned op_type)
@@ -182,16 +191,20 @@ void Operator::setOperator(Operator *oper, unsigned op_type)
 		else
 			operators[op_type]=oper;
 	}
+
+	setReferencesModified();
 }
 
 void Operator::setHashes(bool value)
 {
 	hashes=value;
+	setCodeInvalidated();
 }
 
 void Operator::setMerges(bool value)
 {
 	merges=value;
+	setCodeInvalidated();
 }
 
 Function *Operator::getFunction(unsigned func_type)
@@ -290,8 +303,7 @@ QString Operator::getCodeDefinition(unsigned def_type, bool reduced_form)
 				attributes[atribs_ops[i]]=operators[i]->getName(true);
 			else
 			{
-				operators[i]->attributes[ParsersAttributes::REF_TYPE]=atribs_ops[i];
-				attributes[atribs_ops[i]]=operators[i]->getCodeDefinition(def_type, true);
+				attributes[atribs_ops[i]]=getReferenceCodeDefinition(operators[i], def_type, atribs_ops[i]);
 			}
 		}
 	}
@@ -304,8 +316,7 @@ QString Operator::getCodeDefinition(unsigned def_type, bool reduced_form)
 				attributes[atribs_funcoes[i]]=functions[i]->getSignature();
 			else
 			{
-				functions[i]->setAttribute(ParsersAttributes::REF_TYPE, atribs_funcoes[i]);
-				attributes[atribs_funcoes[i]]=functions[i]->getCodeDefinition(def_type, true);
+				attributes[atribs_funcoes[i]]=getReferenceCodeDefinition(functions[i], def_type, atribs_funcoes[i]);
 			}
 		}
 	}
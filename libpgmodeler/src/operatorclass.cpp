@@ -24,21 +24,27 @@ void OperatorClass::setDataType(PgSQLType data_type)
 		throw Exception(ERR_ASG_INV_TYPE_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->data_type=data_type;
+
+	setReferencesModified();
 }
 
 void OperatorClass::setFamily(OperatorFamily *family)
 {
 	this->family=family;
+
+	setReferencesModified();
 }
 
 void OperatorClass::setIndexingType(IndexingType index_type)
 {
 	this->indexing_type=index_type;
+	setCodeInvalidated();
 }
 
 void OperatorClass::setDefault(bool value)
 {
 	is_default=value;
+	setCodeInvalidated();
 }
 
 void OperatorClass::setElementsAttribute(unsigned def_type)
@@ -66,6 +72,8 @@ void OperatorClass::addElement(OperatorClassElement elem)
 		throw Exception(ERR_INS_DUPLIC_ELEMENT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	elements.push_back(elem);
+
+	setReferencesModified();
 }
 
 void OperatorClass::removeElement(unsigned elem_idx)
@@ -76,11 +84,15 @@ void OperatorClass::removeElement(unsigned elem_idx)
 
 	//Removes the item from the elements list
 	elements.erase(elements.begin() + elem_idx);
+
+	setReferencesModified();
 }
 
 void OperatorClass::removeElements(void)
 {
 	elements.clear();
+
+	setReferencesModified();
 }
 
 OperatorClassElement OperatorClass::getElement(unsigned elem_idx)
@@ -112,7 +112,7 @@ QString OperatorClassElement::getCodeDefinition(unsigned def_type)
 		if(def_type==SchemaParser::SQL_DEFINITION)
 			attributes[ParsersAttributes::SIGNATURE]=function->getSignature();
 		else
-			attributes[ParsersAttributes::DEFINITION]=function->getCodeDefinition(def_type,true);
+			attributes[ParsersAttributes::DEFINITION]=BaseObject::getReferenceCodeDefinition(function, def_type);
 	}
 	else if(element_type==OPERATOR_ELEM && _operator && strategy_number > 0)
 	{
@@ -124,7 +124,7 @@ QString OperatorClassElement::getCodeDefinition(unsigned def_type)
 		if(def_type==SchemaParser::SQL_DEFINITION)
 			attributes[ParsersAttributes::SIGNATURE]=_operator->getSignature();
 		else
-			attributes[ParsersAttributes::DEFINITION]=_operator->getCodeDefinition(def_type,true);
+			attributes[ParsersAttributes::DEFINITION]=BaseObject::getReferenceCodeDefinition(_operator, def_type);
 	}
 	else if(element_type==STORAGE_ELEM && storage!=PgSQLType::null)
 	{
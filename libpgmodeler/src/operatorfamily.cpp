@@ -9,6 +9,7 @@ OperatorFamily::OperatorFamily(void)
 void OperatorFamily::setIndexingType(IndexingType idx_type)
 {
 	indexing_type=idx_type;
+	setCodeInvalidated();
 }
 
 IndexingType OperatorFamily::getIndexingType(void)
@@ -68,6 +68,7 @@ void Permission::addRole(Role *role)
 
 	//Updates the permission Id
 	generatePermissionId();
+	setCodeInvalidated();
 }
 
 void Permission::setPrivilege(unsigned priv_id, bool value, bool grant_op)
@@ -125,6 +126,7 @@ void Permission::setPrivilege(unsigned priv_id, bool value, bool grant_op)
 
 	privileges[priv_id]=value;
 	this->grant_option[priv_id]=grant_op;
+	setCodeInvalidated();
 }
 
 void Permission::removeRole(unsigned role_idx)
@@ -133,12 +135,14 @@ void Permission::removeRole(unsigned role_idx)
 		throw Exception(ERR_REF_OBJ_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	generatePermissionId();
+	setCodeInvalidated();
 }
 
 void Permission::removeRoles(void)
 {
 	roles.clear();
 	generatePermissionId();
+	setCodeInvalidated();
 }
 
 Role *Permission::getRole(unsigned role_idx)
@@ -266,6 +270,7 @@ void Permission::generatePermissionId(void)
 	this->obj_name=QString(ParsersAttributes::PERMISSION + "_%1.%2")
 								 .arg(object->getObjectId())
 								 .arg(str_aux);
+	setNameModified();
 }
 
 QString Permission::getCodeDefinition(unsigned def_type)
@@ -176,11 +176,25 @@ QString BaseType::type_list[types_count]=
 	"GEOMETRYCOLLECTION"
 };
 
+//The hash must be created after the type list since it's built from the list's contents
+QHash<QString, unsigned> BaseType::type_names=BaseType::createTypeNamesHash();
+
 BaseType::BaseType(void)
 {
 	type_idx=0;
 }
 
+QHash<QString, unsigned> BaseType::createTypeNamesHash(void)
+{
+	QHash<QString, unsigned> names;
+
+	//The empty type (offset 0) isn't inserted since it's never searched by name
+	for(unsigned idx=1; idx < types_count; idx++)
+		names[type_list[idx]]=idx;
+
+	return(names);
+}
+
 QString BaseType::getTypeString(unsigned type_id)
 {
 	if(type_id > types_count)
@@ -226,20 +240,17 @@ void BaseType::getTypes(QStringList &types,unsigned offset,unsigned count)
 
 unsigned BaseType::getType(const QString &type_name,unsigned offset,unsigned count)
 {
-	unsigned idx,total;
-	bool found=false;
+	unsigned idx;
 
 	if(type_name=="")
 		return(BaseType::null);
 	else
 	{
-		total=offset + count;
-
-		for(idx=offset; idx<total && !found; idx++)
-			found=(type_name==BaseType::type_list[idx]);
+		idx=type_names.value(type_name, BaseType::null);
 
-		if(found)
-		{ idx--; return(idx); }
+		//The type is found only if its index is in the interval of the class
+		if(idx >= offset && idx < offset + count)
+			return(idx);
 		else
 			return(BaseType::null);
 	}
@@ -619,10 +630,42 @@ QString SpatialType::operator * (void)
 	return(QString("(%1%2, %3)").arg(type_list[type_idx]).arg(var_str)).arg(srid);
 }
 
+/***************************
+ * CLASS: UserTypeRegistry *
+ ***************************/
+UserTypeRegistry::UserTypeRegistry(void)
+{
+	pmodel=NULL;
+}
+
+UserTypeRegistry::~UserTypeRegistry(void)
+{
+	setModel(NULL);
+}
+
+void UserTypeRegistry::setModel(void *pmodel)
+{
+	map<unsigned, UserTypeConfig>::iterator itr;
+	QWriteLocker locker(&PgSQLType::registries_lock);
+
+	if(this->pmodel)
+		PgSQLType::registries.remove(this->pmodel);
+
+	this->pmodel=pmodel;
+
+	for(itr=types.begin(); itr!=types.end(); itr++)
+		itr->second.pmodel=pmodel;
+
+	if(pmodel)
+		PgSQLType::registries[pmodel]=this;
+}
+
 /********************
  * CLASS: PgSQLType *
  ********************/
-vector<UserTypeConfig> PgSQLType::user_types;
+QHash<void *, UserTypeRegistry *> PgSQLType::registries;
+QReadWriteLock PgSQLType::registries_lock;
+QAtomicInt PgSQLType::next_handle(PgSQLType::pseudo_end + 1);
 
 PgSQLType::PgSQLType(void)
 {
@@ -702,7 +745,7 @@ void PgSQLType::getTypes(QStringList &type_list, bool oids, bool pseudos)
 
 unsigned PgSQLType::operator = (unsigned type_id)
 {
-	if(type_id>=offset)
+	if(type_id > pseudo_end)
 		setUserType(type_id);
 	else if(type_id > 0)
 		BaseType::setType(type_id,offset,types_count);
@@ -714,10 +757,13 @@ unsigned PgSQLType::operator = (unsigned type_id)
 
 unsigned PgSQLType::operator = (const QString &type_name)
 {
-	unsigned type_idx, usr_type_idx;
+	unsigned type_idx, usr_type_idx=BaseType::null;
 
 	type_idx=BaseType::getType(type_name, offset, types_count);
-	usr_type_idx=getUserTypeIndex(type_name, NULL);
+
+	//The user types are searched only when the name isn't a built-in type
+	if(type_idx==BaseType::null)
+		usr_type_idx=getUserTypeIndex(type_name, NULL);
 
 	if(type_idx==0 && usr_type_idx==0)
 		throw Exception(ERR_ASG_INV_TYPE_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
@@ -735,16 +781,20 @@ unsigned PgSQLType::operator = (const QString &type_name)
 
 void *PgSQLType::getUserTypeReference(void)
 {
-	if(this->isUserType())
-		return(user_types[this->type_idx - (pseudo_end + 1)].ptype);
+	UserTypeConfig cfg;
+
+	if(this->isUserType() && findUserType(this->type_idx, cfg))
+		return(cfg.ptype);
 	else
 		return(NULL);
 }
 
 unsigned PgSQLType::getUserTypeConfig(void)
 {
-	if(this->isUserType())
-		return(user_types[this->type_idx - (pseudo_end + 1)].type_conf);
+	UserTypeConfig cfg;
+
+	if(this->isUserType() && findUserType(this->type_idx, cfg))
+		return(cfg.type_conf);
 	else
 		return(0);
 }
@@ -756,17 +806,10 @@ bool PgSQLType::operator == (unsigned type_id)
 
 bool PgSQLType::operator == (const QString &type_name)
 {
-	unsigned idx,total;
-	bool found=false;
-
-	total=offset + types_count;
-
-	for(idx=offset; idx<total && !found; idx++)
-		found=(type_name==BaseType::type_list[idx]);
-
-	if(found) idx--;
+	unsigned idx;
 
-	return(type_idx==idx);
+	idx=BaseType::getType(type_name, offset, types_count);
+	return(idx!=BaseType::null && type_idx==idx);
 }
 
 bool PgSQLType::operator != (const QString &type_name)
@@ -844,13 +887,9 @@ void PgSQLType::setWithTimezone(bool with_tz)
 
 void PgSQLType::setUserType(unsigned type_id)
 {
-	unsigned lim1, lim2;
+	UserTypeConfig cfg;
 
-	lim1=pseudo_end + 1;
-	lim2=lim1 + PgSQLType::user_types.size();
-
-	if(PgSQLType::user_types.size() > 0 &&
-		 (type_id >= lim1 && type_id < lim2))
+	if(type_id > pseudo_end && findUserType(type_id, cfg))
 		type_idx=type_id;
 	else
 		throw Exception(ERR_ASG_INV_TYPE_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
@@ -867,6 +906,27 @@ void PgSQLType::setUserType(void *ptype)
 		type_idx=idx;
 }
 
+bool PgSQLType::findUserType(unsigned type_id, UserTypeConfig &cfg)
+{
+	QHash<void *, UserTypeRegistry *>::iterator itr;
+	map<unsigned, UserTypeConfig>::iterator itr_type;
+	QReadLocker locker(&registries_lock);
+
+	//The handle is searched on each registry since it doesn't carry the model which the type belongs to
+	for(itr=registries.begin(); itr!=registries.end(); itr++)
+	{
+		itr_type=itr.value()->types.find(type_id);
+
+		if(itr_type!=itr.value()->types.end())
+		{
+			cfg=itr_type->second;
+			return(true);
+		}
+	}
+
+	return(false);
+}
+
 void PgSQLType::addUserType(const QString &type_name, void *ptype, void *pmodel, unsigned type_conf)
 {
 	if(type_name!="" && ptype && pmodel &&
@@ -876,56 +936,81 @@ void PgSQLType::addUserType(const QString &type_name, void *ptype, void *pmodel,
 			type_conf==UserTypeConfig::BASE_TYPE) &&
 		 getUserTypeIndex(type_name,ptype,pmodel)==0)
 	{
-		UserTypeConfig cfg;
+		QWriteLocker locker(&registries_lock);
 
-		cfg.name=type_name;
-		cfg.ptype=ptype;
-		cfg.pmodel=pmodel;
-		cfg.type_conf=type_conf;
-		PgSQLType::user_types.push_back(cfg);
+		if(registries.contains(pmodel))
+		{
+			UserTypeRegistry *registry=registries[pmodel];
+			UserTypeConfig cfg;
+			unsigned handle=next_handle.fetchAndAddOrdered(1);
+
+			cfg.name=type_name;
+			cfg.ptype=ptype;
+			cfg.pmodel=pmodel;
+			cfg.type_conf=type_conf;
+
+			registry->types[handle]=cfg;
+			registry->names.insert(type_name, handle);
+			registry->ptypes[ptype]=handle;
+		}
 	}
 }
 
 void PgSQLType::removeUserType(const QString &type_name, void *ptype)
 {
-	if(PgSQLType::user_types.size() > 0 &&
-		 type_name!="" && ptype)
+	if(type_name!="" && ptype)
 	{
-		UserTypeConfig cfg;
-		vector<UserTypeConfig>::iterator itr, itr_end;
-
-		itr=PgSQLType::user_types.begin();
-		itr_end=PgSQLType::user_types.end();
+		QHash<void *, UserTypeRegistry *>::iterator itr;
+		UserTypeRegistry *registry=NULL;
+		unsigned handle;
+		QWriteLocker locker(&registries_lock);
 
-		while(itr!=itr_end)
+		//Since the model isn't informed the type is searched by its pointer on all registries
+		for(itr=registries.begin(); itr!=registries.end() && !registry; itr++)
 		{
-			if(itr->name==type_name && itr->ptype==ptype) break;
-			else itr++;
+			if(itr.value()->ptypes.contains(ptype))
+				registry=itr.value();
 		}
 
-		if(itr!=itr_end)
-			PgSQLType::user_types.erase(itr);
+		if(registry)
+		{
+			handle=registry->ptypes[ptype];
+
+			if(registry->types[handle].name==type_name)
+			{
+				registry->types.erase(handle);
+				registry->names.remove(type_name, handle);
+				registry->ptypes.remove(ptype);
+			}
+		}
 	}
 }
 
 void PgSQLType::renameUserType(const QString &type_name, void *ptype,const QString &new_name)
 {
-	if(PgSQLType::user_types.size() > 0 &&
-		 type_name!="" && ptype && type_name!=new_name)
+	if(type_name!="" && ptype && type_name!=new_name)
 	{
-		vector<UserTypeConfig>::iterator itr, itr_end;
+		QHash<void *, UserTypeRegistry *>::iterator itr;
+		UserTypeRegistry *registry=NULL;
+		unsigned handle;
+		QWriteLocker locker(&registries_lock);
 
-		itr=PgSQLType::user_types.begin();
-		itr_end=PgSQLType::user_types.end();
+		for(itr=registries.begin(); itr!=registries.end() && !registry; itr++)
+		{
+			if(itr.value()->ptypes.contains(ptype))
+				registry=itr.value();
+		}
 
-		while(itr!=itr_end)
+		if(registry)
 		{
-			if(itr->name==type_name && itr->ptype==ptype)
+			handle=registry->ptypes[ptype];
+
+			if(registry->types[handle].name==type_name)
 			{
-				itr->name=new_name;
-				break;
+				registry->types[handle].name=new_name;
+				registry->names.remove(type_name, handle);
+				registry->names.insert(new_name, handle);
 			}
-			itr++;
 		}
 	}
 }
@@ -937,83 +1022,102 @@ unsigned PgSQLType::getBaseTypeIndex(const QString &type_name)
 
 unsigned PgSQLType::getUserTypeIndex(const QString &type_name, void *ptype, void *pmodel)
 {
-	if(PgSQLType::user_types.size() > 0 && (type_name!="" || ptype))
+	if(type_name!="" || ptype)
 	{
-		vector<UserTypeConfig>::iterator itr, itr_end;
-		int idx=0;
-
-		itr=PgSQLType::user_types.begin();
-		itr_end=PgSQLType::user_types.end();
+		QHash<void *, UserTypeRegistry *>::iterator itr;
+		QMultiHash<QString, unsigned>::iterator itr_name;
+		vector<UserTypeRegistry *> regs;
+		UserTypeRegistry *registry=NULL;
+		unsigned handle=BaseType::null, i;
+		QReadLocker locker(&registries_lock);
+
+		/* When the model is informed only its registry is used, otherwise all registries are searched
+			 and, as happens on a sequential search, the first registered type that matches is returned */
+		if(pmodel)
+		{
+			if(registries.contains(pmodel))
+				regs.push_back(registries.value(pmodel));
+		}
+		else
+		{
+			for(itr=registries.begin(); itr!=registries.end(); itr++)
+				regs.push_back(itr.value());
+		}
 
-		while(itr!=itr_end)
+		for(i=0; i < regs.size(); i++)
 		{
-			if(((type_name!="" && itr->name==type_name) || (ptype && itr->ptype==ptype)) &&
-				 ((pmodel && itr->pmodel==pmodel) || !pmodel))
-				break;
+			registry=regs[i];
+
+			if(ptype && registry->ptypes.contains(ptype) &&
+				 (handle==BaseType::null || registry->ptypes[ptype] < handle))
+				handle=registry->ptypes[ptype];
 
-			idx++;
-			itr++;
+			if(type_name!="")
+			{
+				for(itr_name=registry->names.find(type_name);
+						itr_name!=registry->names.end() && itr_name.key()==type_name; itr_name++)
+				{
+					if(handle==BaseType::null || itr_name.value() < handle)
+						handle=itr_name.value();
+				}
+			}
 		}
 
-		if(itr!=itr_end)
-			return(pseudo_end + 1 + idx);
-		else
-			return(BaseType::null);
+		return(handle);
 	}
 	else return(BaseType::null);
 }
 
 QString PgSQLType::getUserTypeName(unsigned type_id)
 {
-	unsigned lim1, lim2;
-
-	lim1=pseudo_end + 1;
-	lim2=lim1 + PgSQLType::user_types.size();
+	UserTypeConfig cfg;
 
-
-	if(PgSQLType::user_types.size() > 0 &&
-		 (type_id >= lim1 && type_id < lim2))
-		return(PgSQLType::user_types[type_id - lim1].name);
+	if(type_id > pseudo_end && findUserType(type_id, cfg))
+		return(cfg.name);
 	else
 		return("");
 }
 
 void PgSQLType::getUserTypes(QStringList &type_list, void *pmodel, unsigned inc_usr_types)
 {
-	unsigned idx,total;
+	map<unsigned, UserTypeConfig>::iterator itr;
+	QReadLocker locker(&registries_lock);
 
 	type_list.clear();
-	total=PgSQLType::user_types.size();
 
-	for(idx=0; idx < total; idx++)
+	//Only the user defined types of the specified model are retrieved
+	if(registries.contains(pmodel))
 	{
-		//Only the user defined types of the specified model are retrieved
-		if(user_types[idx].pmodel==pmodel &&
-			 ((inc_usr_types & user_types[idx].type_conf) == user_types[idx].type_conf))
-			type_list.push_back(user_types[idx].name);
+		for(itr=registries[pmodel]->types.begin(); itr!=registries[pmodel]->types.end(); itr++)
+		{
+			if((inc_usr_types & itr->second.type_conf) == itr->second.type_conf)
+				type_list.push_back(itr->second.name);
+		}
 	}
 }
 
 void PgSQLType::getUserTypes(vector<void *> &ptypes, void *pmodel, unsigned inc_usr_types)
 {
-	unsigned idx, total;
+	map<unsigned, UserTypeConfig>::iterator itr;
+	QReadLocker locker(&registries_lock);
 
 	ptypes.clear();
-	total=PgSQLType::user_types.size();
 
-	for(idx=0; idx < total; idx++)
+	//Only the user defined types of the specified model are retrieved
+	if(registries.contains(pmodel))
 	{
-		//Only the user defined types of the specified model are retrieved
-		if(user_types[idx].pmodel==pmodel &&
-			 ((inc_usr_types & user_types[idx].type_conf) == user_types[idx].type_conf))
-			ptypes.push_back(user_types[idx].ptype);
+		for(itr=registries[pmodel]->types.begin(); itr!=registries[pmodel]->types.end(); itr++)
+		{
+			if((inc_usr_types & itr->second.type_conf) == itr->second.type_conf)
+				ptypes.push_back(itr->second.ptype);
+		}
 	}
 }
 
 QString PgSQLType::operator ~ (void)
 {
 	if(type_idx >= pseudo_end + 1)
-		return(user_types[type_idx - (pseudo_end + 1)].name);
+		return(getUserTypeName(type_idx));
 	else
 		return(BaseType::type_list[type_idx]);
 }
@@ -1055,9 +1159,9 @@ void PgSQLType::setDimension(unsigned dim)
 {
 	if(dim > 0 && this->isUserType())
 	{
-		int idx=getUserTypeIndex(~(*this), NULL);
-		if(user_types[idx].type_conf==UserTypeConfig::DOMAIN_TYPE ||
-			 user_types[idx].type_conf==UserTypeConfig::SEQUENCE_TYPE)
+		unsigned conf=getUserTypeConfig();
+		if(conf==UserTypeConfig::DOMAIN_TYPE ||
+			 conf==UserTypeConfig::SEQUENCE_TYPE)
 			throw Exception(ERR_ASG_INV_DOMAIN_ARRAY,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
@@ -30,6 +30,9 @@
 #include "schemaparser.h"
 #include <vector>
 #include <map>
+#include <QHash>
+#include <QAtomicInt>
+#include <QReadWriteLock>
 
 using namespace std;
 
@@ -37,6 +40,12 @@ class BaseType{
 	private:
 		static const unsigned types_count=189;
 
+		//! \brief Stores the index of each type name on type_list avoiding linear searches on type name resolution
+		static QHash<QString, unsigned> type_names;
+
+		//! \brief Creates the type names hash from the type_list
+		static QHash<QString, unsigned> createTypeNamesHash(void);
+
 	protected:
 		static QString type_list[types_count];
 
@@ -302,6 +311,40 @@ class UserTypeConfig {
 		UserTypeConfig(void)
 		{ name=""; ptype=NULL; pmodel=NULL; type_conf=BASE_TYPE; }
 
+		friend class PgSQLType;
+		friend class UserTypeRegistry;
+};
+
+/*! \brief Stores the user defined types of a database model. Each type is identified by a handle
+ (its id as a PgSQLType) which is unique between all models and doesn't change while the type exists,
+ so removing a type doesn't affect the others. The registry must be owned by the model and is
+ made visible to PgSQLType through setModel() */
+class UserTypeRegistry {
+	private:
+		//! \brief Model which the registry belongs to
+		void *pmodel;
+
+		//! \brief User defined types indexed by handle (the map keeps the types in the registration order)
+		map<unsigned, UserTypeConfig> types;
+
+		/*! \brief Handles of the types by name. More than one handle is associated to a name only
+		 temporarily while objects are being renamed */
+		QMultiHash<QString, unsigned> names;
+
+		//! \brief Handles of the types by the pointer to the instance of the type
+		QHash<void *, unsigned> ptypes;
+
+		//! \brief The registry can't be copied since the handles are related to its address
+		UserTypeRegistry(const UserTypeRegistry &);
+		void operator = (const UserTypeRegistry &);
+
+	public:
+		UserTypeRegistry(void);
+		~UserTypeRegistry(void);
+
+		//! \brief Associates the registry to the passed model making its types available to PgSQLType
+		void setModel(void *pmodel);
+
 		friend class PgSQLType;
 };
 
@@ -318,8 +361,20 @@ class PgSQLType: public BaseType{
 		static const unsigned pseudo_start=79;
 		static const unsigned pseudo_end=90;
 
-		//! \brief Configuration for user defined types
-		static vector<UserTypeConfig> user_types;
+		//! \brief User defined types registries of each open model
+		static QHash<void *, UserTypeRegistry *> registries;
+
+		/*! \brief Guards the registries since the types can be resolved by worker threads (e.g. columns created
+		 by relationships connected in parallel) while they are changed only by the thread that owns the models */
+		static QReadWriteLock registries_lock;
+
+		//! \brief Next handle to be assigned to a user defined type
+		static QAtomicInt next_handle;
+
+		/*! \brief Copies to 'cfg' the configuration of the user defined type with the passed handle searching it on
+		 the registries of the open models. The configuration is copied while the registries are locked since they
+		 can be changed by another thread once the lock is released. Returns false when the type doesn't exists */
+		static bool findUserType(unsigned type_id, UserTypeConfig &cfg);
 
 		//! \brief Dimension of the type if it's configured as array
 		unsigned dimension,
@@ -433,6 +488,7 @@ class PgSQLType: public BaseType{
 		friend class Table;
 		friend class Sequence;
 		friend class DatabaseModel;
+		friend class UserTypeRegistry;
 };
 
 class BehaviorType: public BaseType{
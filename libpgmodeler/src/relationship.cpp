@@ -89,6 +89,7 @@ void Relationship::setMandatoryTable(unsigned table_id, bool value)
 {
 	BaseRelationship::setMandatoryTable(table_id, value);
 	this->invalidated=true;
+	setCodeInvalidated();
 }
 
 void Relationship::setTableSuffix(unsigned table_id, const QString &suffix)
@@ -107,6 +108,7 @@ void Relationship::setTableSuffix(unsigned table_id, const QString &suffix)
 		dst_suffix=suffix;
 
 	this->invalidated=true;
+	setCodeInvalidated();
 }
 
 QString Relationship::getTableSuffix(unsigned table_id)
@@ -124,6 +126,7 @@ void Relationship::setDeferrable(bool value)
 {
 	deferrable=value;
 	this->invalidated=true;
+	setCodeInvalidated();
 }
 
 void Relationship::setIdentifier(bool value)
@@ -140,6 +143,7 @@ void Relationship::setIdentifier(bool value)
 
 	identifier=value;
 	this->invalidated=true;
+	setCodeInvalidated();
 }
 
 void Relationship::setSpecialPrimaryKeyCols(vector<unsigned> &cols)
@@ -152,6 +156,7 @@ void Relationship::setSpecialPrimaryKeyCols(vector<unsigned> &cols)
 										ERR_INV_USE_ESPECIAL_PK,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->column_ids_pk_rel=cols;
+	setCodeInvalidated();
 }
 
 vector<unsigned> Relationship::getSpecialPrimaryKeyCols(void)
@@ -206,6 +211,7 @@ void Relationship::setTableNameRelNN(const QString &name)
 
 	tab_name_relnn=name;
 	this->invalidated=true;
+	setCodeInvalidated();
 }
 
 QString Relationship::getTableNameRelNN(void)
@@ -222,6 +228,7 @@ void Relationship::setDeferralType(DeferralType defer_type)
 {
 	deferral_type=defer_type;
 	this->invalidated=true;
+	setCodeInvalidated();
 }
 
 DeferralType Relationship::getDeferralType(void)
@@ -372,12 +379,16 @@ void Relationship::addObject(TableObject *tab_obj, int obj_idx)
 		else
 			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
+
+	setReferencesModified();
 }
 
 void Relationship::removeObjects(void)
 {
 	rel_attributes.clear();
 	rel_constraints.clear();
+
+	setReferencesModified();
 }
 
 void Relationship::destroyObjects(void)
@@ -450,6 +461,8 @@ void Relationship::removeObject(unsigned obj_id, ObjectType obj_type)
 
 	//Reconnects the relationship
 	connectRelationship();
+
+	setReferencesModified();
 }
 
 void Relationship::removeObject(TableObject *object)
@@ -2143,6 +2156,7 @@ void Relationship::setAutomaticSuffix(bool value)
 {
 	this->invalidated=(this->auto_suffix!=value);
 	this->auto_suffix=value;
+	setCodeInvalidated();
 }
 
 bool Relationship::isAutomaticSuffix(void)
@@ -1,11 +1,11 @@
 #include "role.h"
 
-unsigned Role::role_id=0;
+QAtomicInt Role::role_id(0);
 
 Role::Role(void)
 {
 	obj_type=OBJ_ROLE;
-	object_id=Role::role_id++;
+	object_id=Role::role_id.fetchAndAddOrdered(1);
 	sysid=100;
 
 	for(unsigned i=0; i < 6; i++)
@@ -36,6 +36,7 @@ void Role::setSysid(unsigned sysid)
 		throw Exception(ERR_ASG_INV_ID_USER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->sysid=sysid;
+	setCodeInvalidated();
 }
 
 void Role::setOption(unsigned op_type, bool value)
@@ -45,6 +46,8 @@ void Role::setOption(unsigned op_type, bool value)
 	else
 		//Raises an error if the option type is invalid
 		throw Exception(ERR_ASG_VAL_INV_ROLE_OPT_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	setCodeInvalidated();
 }
 
 void Role::addRole(unsigned role_type, Role *role)
@@ -124,21 +127,26 @@ void Role::addRole(unsigned role_type, Role *role)
 			}
 		}
 	}
+
+	setReferencesModified();
 }
 
 void Role::setConnectionLimit(int limit)
 {
 	conn_limit=limit;
+	setCodeInvalidated();
 }
 
 void Role::setValidity(const QString &date)
 {
 	validity=date;
+	setCodeInvalidated();
 }
 
 void Role::setPassword(const QString &passwd)
 {
 	this->password=passwd;
+	setCodeInvalidated();
 }
 
 void Role::setRoleAttribute(unsigned role_type)
@@ -195,6 +203,8 @@ void Role::removeRole(unsigned role_type, unsigned role_idx)
 
 	itr=list->begin() + role_idx;
 	list->erase(itr);
+
+	setReferencesModified();
 }
 
 void Role::removeRoles(unsigned role_type)
@@ -213,6 +223,8 @@ void Role::removeRoles(unsigned role_type)
 	}
 
 	list->clear();
+
+	setReferencesModified();
 }
 
 bool Role::isRoleExists(unsigned role_type, Role *role)
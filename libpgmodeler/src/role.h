@@ -30,7 +30,7 @@
 
 class Role: public BaseObject {
 	private:
-		static unsigned role_id;
+		static QAtomicInt role_id;
 
 		//! \brief Role id
 		unsigned sysid;
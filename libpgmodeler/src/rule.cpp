@@ -29,16 +29,19 @@ void Rule::setCommandsAttribute(void)
 void Rule::setEventType(EventType type)
 {
 	event_type=type;
+	setCodeInvalidated();
 }
 
 void Rule::setExecutionType(ExecutionType type)
 {
 	execution_type=type;
+	setCodeInvalidated();
 }
 
 void Rule::setConditionalExpression(const QString &expr)
 {
 	conditional_expr=expr;
+	setCodeInvalidated();
 }
 
 void Rule::addCommand(const QString &cmd)
@@ -52,6 +55,7 @@ void Rule::addCommand(const QString &cmd)
 		cmd_aux.remove(";");
 		commands.push_back(cmd_aux);
 	}
+	setCodeInvalidated();
 }
 
 EventType Rule::getEventType(void)
@@ -90,11 +94,13 @@ void Rule::removeCommand(unsigned cmd_idx)
 		throw Exception(ERR_REF_RULE_CMD_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	commands.erase(commands.begin() + cmd_idx);
+	setCodeInvalidated();
 }
 
 void Rule::removeCommands(void)
 {
 	commands.clear();
+	setCodeInvalidated();
 }
 
 QString Rule::getCodeDefinition(unsigned def_type)
@@ -1,11 +1,11 @@
 #include "schema.h"
 
-unsigned Schema::schema_id=30000;
+QAtomicInt Schema::schema_id(30000);
 
 Schema::Schema(void)
 {
 	obj_type=OBJ_SCHEMA;
-	object_id=Schema::schema_id++;
+	object_id=Schema::schema_id.fetchAndAddOrdered(1);
 	fill_color=QColor(225,225,225, 80);
 	rect_visible=true;
 
@@ -29,6 +29,7 @@ void Schema::setName(const QString &name)
 void Schema::setFillColor(const QColor &color)
 {
 	this->fill_color=color;
+	setCodeInvalidated();
 }
 
 QColor Schema::getFillColor(void)
@@ -39,6 +40,7 @@ QColor Schema::getFillColor(void)
 void Schema::setRectVisible(bool value)
 {
 	rect_visible=value;
+	setCodeInvalidated();
 }
 
 bool Schema::isRectVisible(void)
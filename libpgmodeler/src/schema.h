@@ -31,7 +31,7 @@
 
 class Schema: public BaseGraphicObject {
 	private:
-		static unsigned schema_id;
+		static QAtomicInt schema_id;
 
 		QColor fill_color;
 
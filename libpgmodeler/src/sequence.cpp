@@ -168,6 +168,7 @@ void Sequence::setSchema(BaseObject *schema)
 void Sequence::setCycle(bool value)
 {
 	cycle=value;
+	setCodeInvalidated();
 }
 
 void Sequence::setValues(QString minv, QString maxv, QString inc, QString start, QString cache)
@@ -201,6 +202,7 @@ void Sequence::setValues(QString minv, QString maxv, QString inc, QString start,
 	this->increment=inc;
 	this->cache=cache;
 	this->start=start;
+	setCodeInvalidated();
 }
 
 void Sequence::setOwnerColumn(Table *table, const QString &col_name)
@@ -234,8 +236,10 @@ void Sequence::setOwnerColumn(Table *table, const QString &col_name)
 		 sequence id, change the sequence id to be greater to avoid reference errors */
 		if(this->owner_col && this->owner_col->isAddedByRelationship() &&
 			 this->owner_col->getObjectId() > this->object_id)
-			this->object_id=BaseObject::getGlobalId();
+			this->object_id=BaseObject::generateObjectId();
 	}
+
+	setReferencesModified();
 }
 
 void Sequence::setOwnerColumn(Column *column)
@@ -272,8 +276,10 @@ void Sequence::setOwnerColumn(Column *column)
 		 sequence id, change the sequence id to be greater to avoid reference errors */
 		if(column && column->isAddedByRelationship() &&
 			 column->getObjectId() > this->object_id)
-			this->object_id=BaseObject::getGlobalId();
+			this->object_id=BaseObject::generateObjectId();
 	}
+
+	setReferencesModified();
 }
 
 bool Sequence::isReferRelationshipAddedColumn(void)
@@ -10,6 +10,14 @@ Table::Table(void) : BaseTable()
 	attributes[ParsersAttributes::RULES]="";
 	attributes[ParsersAttributes::OIDS]="";
 	attributes[ParsersAttributes::COLS_COMMENT]="";
+
+	//Creates the names index of each object type
+	obj_positions[OBJ_COLUMN];
+	obj_positions[OBJ_CONSTRAINT];
+	obj_positions[OBJ_TRIGGER];
+	obj_positions[OBJ_INDEX];
+	obj_positions[OBJ_RULE];
+
 	this->setName(trUtf8("new_table").toUtf8());
 }
 
@@ -19,6 +27,9 @@ Table::~Table(void)
 											 OBJ_CONSTRAINT, OBJ_COLUMN };
 	vector<TableObject *> *list=NULL;
 
+	//Clears the indexes so the notifications of the objects being destroyed are ignored
+	obj_names.clear();
+
 	for(unsigned i=0; i < 5; i++)
 	{
 		list=getObjectList(types[i]);
@@ -50,6 +61,7 @@ void Table::setSchema(BaseObject *schema)
 void Table::setWithOIDs(bool value)
 {
 	with_oid=value;
+	setCodeInvalidated();
 }
 
 void Table::setProtected(bool value)
@@ -365,15 +377,34 @@ void Table::addObject(BaseObject *obj, int obj_idx, bool copy_tab)
 
 					//Adds the object to the table
 					if(obj_idx < 0 || obj_idx >= static_cast<int>(obj_list->size()))
+					{
+						obj_idx=obj_list->size();
 						obj_list->push_back(tab_obj);
+					}
 					else
 					{
 						//If there is a object index specified inserts the object at the position
 						if(obj_list->size() > 0)
 							obj_list->insert((obj_list->begin() + obj_idx), tab_obj);
 						else
+						{
+							obj_idx=0;
 							obj_list->push_back(tab_obj);
+						}
 					}
+
+					//Indexes the object by name and, for constraints, indexes and triggers, by the columns they reference
+					obj_names[tab_obj]=tab_obj->getName();
+					updateObjectPositions(obj_type, obj_idx);
+
+					if(obj_type==OBJ_CONSTRAINT || obj_type==OBJ_INDEX || obj_type==OBJ_TRIGGER)
+					{
+						obj_cols[tab_obj];
+						outdated_refs.insert(tab_obj);
+					}
+
+					//The table objects are stored on the model's references graph so it must be updated
+					setReferencesModified();
 				break;
 
 				case OBJ_TABLE:
@@ -502,8 +533,15 @@ void Table::removeObject(unsigned obj_idx, ObjectType obj_type)
 		if(obj_type!=OBJ_COLUMN)
 		{
 			itr=obj_list->begin() + obj_idx;
+			removeColumnReferences(*itr);
+			obj_cols.remove(*itr);
+			outdated_refs.remove(*itr);
+			obj_positions[obj_type].remove(obj_names[*itr]);
+			obj_names.remove(*itr);
 			(*itr)->setParentTable(NULL);
 			obj_list->erase(itr);
+			updateObjectPositions(obj_type, obj_idx);
+			setReferencesModified();
 		}
 		else
 		{
@@ -529,8 +567,12 @@ void Table::removeObject(unsigned obj_idx, ObjectType obj_type)
 						ERR_REM_INDIRECT_REFERENCE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 			}
 
+			obj_positions[OBJ_COLUMN].remove(obj_names[column]);
+			obj_names.remove(column);
 			column->setParentTable(NULL);
 			columns.erase(itr);
+			updateObjectPositions(OBJ_COLUMN, obj_idx);
+			setReferencesModified();
 		}
 	}
 }
@@ -638,29 +680,34 @@ BaseObject *Table::getObject(const QString &name, ObjectType obj_type, int &obj_
 		 obj_type==OBJ_TRIGGER ||
 		 obj_type==OBJ_INDEX || obj_type==OBJ_RULE)
 	{
-		vector<TableObject *>::iterator itr, itr_end;
+		QHash<QString, unsigned> *positions=NULL;
+		QHash<QString, unsigned>::iterator itr;
 		vector<TableObject *> *obj_list=NULL;
 		int count;
-		QString aux_name=name;
+		QString aux_name=name, key;
 
 		count=aux_name.count(QChar('\0'));
 		if(count >=1) aux_name.chop(count);
 
+		/* The names index uses the unformatted names as key so the quotes of a
+			 formatted name are removed before the search */
+		key=aux_name;
+		if(format && key.size() > 2 && key.startsWith(QChar('"')) && key.endsWith(QChar('"')))
+			key=key.mid(1, key.size()-2);
+
 		obj_list=getObjectList(obj_type);
-		itr=obj_list->begin();
-		itr_end=obj_list->end();
+		positions=&obj_positions[obj_type];
+		itr=positions->find(key);
 
-		while(itr!=itr_end)
-		{
-			found=((*itr)->getName(format)==aux_name);
-			if(!found) itr++;
-			else break;
-		}
+		/* The found object is confirmed comparing its name in the same form of the searched one
+			 since a formatted name is quoted only when needed */
+		found=(itr!=positions->end() && itr.value() < obj_list->size() &&
+					 obj_list->at(itr.value())->getName(format)==aux_name);
 
 		if(found)
 		{
-			obj_idx=(itr-obj_list->begin());
-			object=(*itr);
+			obj_idx=itr.value();
+			object=obj_list->at(obj_idx);
 		}
 		else obj_idx=-1;
 	}
@@ -975,15 +1022,19 @@ bool Table::isConstraintRefColumn(Column *column, ConstraintType constr_type)
 
 	if(column)
 	{
-		itr=constraints.begin();
-		itr_end=constraints.end();
-		while(itr!=itr_end && !found)
+		updateColumnReferences();
+
+		if(col_refs.contains(column))
 		{
-			constr=dynamic_cast<Constraint *>(*itr);
-			itr++;
-			found=(constr->getConstraintType()==constr_type &&
-						 (constr->isColumnExists(column, Constraint::SOURCE_COLS) ||
-							constr->isColumnExists(column, Constraint::REFERENCED_COLS)));
+			itr=col_refs[column].begin();
+			itr_end=col_refs[column].end();
+
+			while(itr!=itr_end && !found)
+			{
+				constr=dynamic_cast<Constraint *>(*itr);
+				itr++;
+				found=(constr && constr->getConstraintType()==constr_type);
+			}
 		}
 	}
 
@@ -1077,6 +1128,9 @@ void Table::swapObjectsIndexes(ObjectType obj_type, unsigned idx1, unsigned idx2
 				(*itr1)=(*itr2);
 				(*itr2)=aux_obj;
 			}
+
+			updateObjectPositions(obj_type);
+			setCodeInvalidated();
 		}
 	}
 	catch(Exception &e)
@@ -1089,72 +1143,182 @@ void Table::getColumnReferences(Column *column, vector<TableObject *> &refs, boo
 {
 	if(column && !column->isAddedByRelationship())
 	{
-		unsigned count, i;
-		IndexElement elem;
-		Column *col=NULL, *col1=NULL;
+		ObjectType types[]={ OBJ_INDEX, OBJ_CONSTRAINT, OBJ_TRIGGER };
+		map<int, TableObject *> ordered[3];
+		map<int, TableObject *>::iterator itr_ord;
 		vector<TableObject *>::iterator itr, itr_end;
+		unsigned i;
 		bool found=false;
-		Index *ind=NULL;
-		Constraint *constr=NULL;
-		Trigger *trig=NULL;
 
-		itr=indexes.begin();
-		itr_end=indexes.end();
+		updateColumnReferences();
 
-		while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !found)))
+		if(col_refs.contains(column))
 		{
-			ind=dynamic_cast<Index *>(*itr);
-			itr++;
+			itr=col_refs[column].begin();
+			itr_end=col_refs[column].end();
 
-			count=ind->getElementCount();
-			for(i=0; i < count  && (!exclusion_mode || (exclusion_mode && !found)); i++)
+			/* The references are stored in the order they were updated, so they are ordered by
+				 type (indexes, constraints and triggers) and then by their positions on the table */
+			while(itr!=itr_end)
 			{
-				elem=ind->getElement(i);
-				col=elem.getColumn();
-				if(col && col==column)
+				for(i=0; i < 3; i++)
 				{
+					if((*itr)->getObjectType()==types[i])
+						ordered[i][getObjectIndex(*itr)]=(*itr);
+				}
+
+				itr++;
+			}
+
+			for(i=0; i < 3 && (!exclusion_mode || !found); i++)
+			{
+				for(itr_ord=ordered[i].begin(); itr_ord!=ordered[i].end() && (!exclusion_mode || !found); itr_ord++)
+				{
+					//In exclusion mode only the first reference is returned
 					found=true;
-					refs.push_back(ind);
+					refs.push_back(itr_ord->second);
 				}
 			}
 		}
+	}
+}
 
-		itr=constraints.begin();
-		itr_end=constraints.end();
+void Table::updateObjectPositions(ObjectType obj_type, unsigned start_idx)
+{
+	vector<TableObject *> *obj_list=getObjectList(obj_type);
+	QHash<QString, unsigned> &positions=obj_positions[obj_type];
 
-		while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !found)))
-		{
-			constr=dynamic_cast<Constraint *>(*itr);
-			itr++;
+	for(unsigned idx=start_idx; idx < obj_list->size(); idx++)
+		positions[obj_names.value(obj_list->at(idx))]=idx;
+}
 
-			col=constr->getColumn(column->getName(),true);
-			col1=constr->getColumn(column->getName(),false);
+void Table::updateObjectName(TableObject *object)
+{
+	if(object && obj_names.contains(object) && obj_names[object]!=object->getName())
+	{
+		QHash<QString, unsigned> &positions=obj_positions[object->getObjectType()];
+		vector<TableObject *> *obj_list=getObjectList(object->getObjectType());
+		QString prev_name=obj_names[object];
+		int idx=-1;
 
-			if((col && col==column) || (col1 && col1==column))
-			{
-				found=true;
-				refs.push_back(constr);
-			}
+		//Gets the position of the object using its previous name
+		if(positions.contains(prev_name) && obj_list->at(positions[prev_name])==object)
+		{
+			idx=positions[prev_name];
+			positions.remove(prev_name);
+		}
+		else
+		{
+			vector<TableObject *>::iterator itr=std::find(obj_list->begin(), obj_list->end(), object);
+			if(itr!=obj_list->end()) idx=itr-obj_list->begin();
 		}
 
-		itr=triggers.begin();
-		itr_end=triggers.end();
+		obj_names[object]=object->getName();
 
-		while(itr!=itr_end && (!exclusion_mode || (exclusion_mode && !found)))
+		if(idx >= 0)
+			positions[object->getName()]=idx;
+	}
+}
+
+void Table::setColumnReferencesOutdated(TableObject *object)
+{
+	if(object && obj_cols.contains(object) && obj_names.contains(object))
+		outdated_refs.insert(object);
+}
+
+void Table::updateColumnReferences(void)
+{
+	QSet<TableObject *>::iterator itr;
+	vector<Column *> cols;
+	vector<Column *>::iterator itr_col;
+	TableObject *object=NULL;
+	Constraint *constr=NULL;
+	Index *index=NULL;
+	Trigger *trig=NULL;
+	Column *col=NULL;
+	unsigned i, count;
+
+	for(itr=outdated_refs.begin(); itr!=outdated_refs.end(); itr++)
+	{
+		object=(*itr);
+
+		//Objects removed from the table after the notification are ignored
+		if(obj_names.contains(object))
 		{
-			trig=dynamic_cast<Trigger *>(*itr);
-			itr++;
+			removeColumnReferences(object);
+			cols.clear();
 
-			count=trig->getColumnCount();
-			for(i=0; i < count && (!exclusion_mode || (exclusion_mode && !found)); i++)
+			if(object->getObjectType()==OBJ_CONSTRAINT)
 			{
-				if(trig->getColumn(i)==column)
+				constr=dynamic_cast<Constraint *>(object);
+
+				count=constr->getColumnCount(Constraint::SOURCE_COLS);
+				for(i=0; i < count; i++)
+					cols.push_back(constr->getColumn(i, Constraint::SOURCE_COLS));
+
+				count=constr->getColumnCount(Constraint::REFERENCED_COLS);
+				for(i=0; i < count; i++)
+					cols.push_back(constr->getColumn(i, Constraint::REFERENCED_COLS));
+			}
+			else if(object->getObjectType()==OBJ_INDEX)
+			{
+				index=dynamic_cast<Index *>(object);
+				count=index->getElementCount();
+
+				for(i=0; i < count; i++)
 				{
-					found=true;
-					refs.push_back(trig);
+					col=index->getElement(i).getColumn();
+					if(col) cols.push_back(col);
 				}
 			}
+			else if(object->getObjectType()==OBJ_TRIGGER)
+			{
+				trig=dynamic_cast<Trigger *>(object);
+				count=trig->getColumnCount();
+
+				for(i=0; i < count; i++)
+					cols.push_back(trig->getColumn(i));
+			}
+
+			for(itr_col=cols.begin(); itr_col!=cols.end(); itr_col++)
+			{
+				//A column can be referenced twice by the same object (e.g. self referencing foreign keys)
+				if(std::find(col_refs[*itr_col].begin(), col_refs[*itr_col].end(), object)==col_refs[*itr_col].end())
+					col_refs[*itr_col].push_back(object);
+			}
+
+			obj_cols[object]=cols;
+		}
+	}
+
+	outdated_refs.clear();
+}
+
+void Table::removeColumnReferences(TableObject *object)
+{
+	vector<Column *>::iterator itr, itr_end;
+	vector<TableObject *> *refs=NULL;
+
+	if(object && obj_cols.contains(object))
+	{
+		itr=obj_cols[object].begin();
+		itr_end=obj_cols[object].end();
+
+		while(itr!=itr_end)
+		{
+			if(col_refs.contains(*itr))
+			{
+				refs=&col_refs[*itr];
+				refs->erase(std::remove(refs->begin(), refs->end(), object), refs->end());
+
+				if(refs->empty())
+					col_refs.remove(*itr);
+			}
+
+			itr++;
 		}
+
+		obj_cols[object].clear();
 	}
 }
 
@@ -34,6 +34,9 @@
 #include "trigger.h"
 #include "function.h"
 #include "role.h"
+#include <QHash>
+#include <QSet>
+#include <algorithm>
 
 class Table: public BaseTable {
 	private:
@@ -53,6 +56,38 @@ class Table: public BaseTable {
 		//! \brief Indicates if the table accepts OIDs
 		bool with_oid;
 
+		/*! \brief Positions of the table objects on their lists indexed by name. There is one hash
+		 for each object type (columns, constraints, triggers, indexes and rules) */
+		map<ObjectType, QHash<QString, unsigned> > obj_positions;
+
+		//! \brief Names used as key of each table object on obj_positions
+		QHash<TableObject *, QString> obj_names;
+
+		//! \brief Constraints, indexes and triggers of the table that reference each column
+		QHash<Column *, vector<TableObject *> > col_refs;
+
+		//! \brief Columns referenced by each constraint, index and trigger of the table (inverse of col_refs)
+		QHash<TableObject *, vector<Column *> > obj_cols;
+
+		/*! \brief Objects which referenced columns were changed. Their entries on col_refs are updated
+		 only on the next search since the changes can be made after the notification (e.g. on copies of objects) */
+		QSet<TableObject *> outdated_refs;
+
+		//! \brief Updates the positions on the names index of the objects of the specified type from 'start_idx'
+		void updateObjectPositions(ObjectType obj_type, unsigned start_idx=0);
+
+		//! \brief Updates the key of the passed object on the names index. Called when the object is renamed
+		void updateObjectName(TableObject *object);
+
+		//! \brief Marks the columns referenced by the passed object as outdated (see outdated_refs)
+		void setColumnReferencesOutdated(TableObject *object);
+
+		//! \brief Updates the column references of the objects marked as outdated
+		void updateColumnReferences(void);
+
+		//! \brief Removes the column references of the passed object
+		void removeColumnReferences(TableObject *object);
+
 		/*! \brief Gets one table ancestor (OBJ_TABLE) or copy (BASE_TABLE) using its name and stores
 		 the index of the found object on parameter 'obj_idx' */
 		BaseObject *getObject(const QString &name, ObjectType obj_type, int &obj_idx);
@@ -275,6 +310,7 @@ class Table: public BaseTable {
 
 		friend class Relationship;
 		friend class OperationList;
+		friend class TableObject;
 };
 
 #endif
@@ -1,4 +1,5 @@
 #include "tableobject.h"
+#include "table.h"
 
 TableObject::TableObject(void)
 {
@@ -6,6 +7,35 @@ TableObject::TableObject(void)
 	add_by_linking=add_by_generalization=add_by_copy=false;
 }
 
+void TableObject::setCodeInvalidated(void)
+{
+	BaseObject::setCodeInvalidated();
+
+	if(parent_table)
+		parent_table->setCodeInvalidated();
+}
+
+void TableObject::setNameModified(void)
+{
+	BaseObject::setNameModified();
+
+	if(parent_table && parent_table->getObjectType()==OBJ_TABLE)
+		dynamic_cast<Table *>(parent_table)->updateObjectName(this);
+}
+
+void TableObject::setReferencesModified(void)
+{
+	BaseObject::setReferencesModified();
+
+	if(parent_table && parent_table->getObjectType()==OBJ_TABLE)
+	{
+		dynamic_cast<Table *>(parent_table)->setColumnReferencesOutdated(this);
+
+		//The references of the object are stored on the model's references graph as references of the parent table
+		notifyModification(parent_table->getDatabase(), parent_table, REFS_MODIFIED);
+	}
+}
+
 void TableObject::setParentTable(BaseTable *table)
 {
 	//Raises an error if the parent object is not a table
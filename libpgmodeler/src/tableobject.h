@@ -55,6 +55,13 @@ class TableObject: public BaseObject {
 		//! \brief Defines that the object is include by copy relationship
 		void setAddedByCopy(bool value);
 
+		//! \brief Updates the name of the object on the parent table's names index
+		void setNameModified(void);
+
+		/*! \brief Marks the columns referenced by the object as outdated on the parent table's references index
+		 and notifies the model that owns the parent table */
+		void setReferencesModified(void);
+
 	public:
 		TableObject(void);
 
@@ -64,6 +71,9 @@ class TableObject: public BaseObject {
 		//! \brief Returns the object parent table
 		BaseTable *getParentTable(void);
 
+		//! \brief Discards the cached code of the object and of its parent table (which code includes the object)
+		void setCodeInvalidated(void);
+
 		/*! \brief This method is purely virtual to force the derived classes
 	overload this method. This also makes class TableObject
 	not instantiable */
@@ -1,12 +1,12 @@
 #include "tablespace.h"
 
-unsigned Tablespace::tabspace_id=10000;
+QAtomicInt Tablespace::tabspace_id(10000);
 
 Tablespace::Tablespace(void)
 {
 	obj_type=OBJ_TABLESPACE;
 	attributes[ParsersAttributes::DIRECTORY]="";
-	object_id=Tablespace::tabspace_id++;
+	object_id=Tablespace::tabspace_id.fetchAndAddOrdered(1);
 }
 
 void Tablespace::setName(const QString &name)
@@ -32,6 +32,7 @@ void Tablespace::setDirectory(const QString &dir)
 		throw Exception(ERR_ASG_EMPTY_DIR_NAME,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->directory=dir_aux;
+	setCodeInvalidated();
 }
 
 QString Tablespace::getDirectory(void)
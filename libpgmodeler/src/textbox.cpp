@@ -45,11 +45,13 @@ void Textbox::setTextAttribute(unsigned attrib, bool value)
 		throw Exception(ERR_REF_ATTRIB_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	text_attributes[attrib]=value;
+	setCodeInvalidated();
 }
 
 void Textbox::setTextColor(const QColor &color)
 {
 	text_color=color;
+	setCodeInvalidated();
 }
 
 QColor Textbox::getTextColor(void)
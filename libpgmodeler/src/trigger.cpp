@@ -35,6 +35,7 @@ Trigger::Trigger(void)
 void Trigger::addArgument(const QString &arg)
 {
 	arguments.push_back(arg);
+	setCodeInvalidated();
 }
 
 void Trigger::setArgumentAttribute(unsigned def_type)
@@ -59,6 +60,7 @@ void Trigger::setArgumentAttribute(unsigned def_type)
 void Trigger::setFiringType(FiringType firing_type)
 {
 	this->firing_type=firing_type;
+	setCodeInvalidated();
 }
 
 void Trigger::setEvent(EventType event, bool value)
@@ -67,6 +69,7 @@ void Trigger::setEvent(EventType event, bool value)
 		throw Exception(ERR_REF_INV_TRIGGER_EVENT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	events[event]=value;
+	setCodeInvalidated();
 }
 
 void Trigger::setFunction(Function *func)
@@ -91,11 +94,14 @@ void Trigger::setFunction(Function *func)
 		else
 			this->function=func;
 	}
+
+	setReferencesModified();
 }
 
 void Trigger::setCondition(const QString &cond)
 {
 	this->condition=cond;
+	setCodeInvalidated();
 }
 
 void Trigger::addColumn(Column *column)
@@ -112,6 +118,8 @@ void Trigger::addColumn(Column *column)
 										ERR_ASG_INV_COLUMN_TRIGGER,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	upd_columns.push_back(column);
+
+	setReferencesModified();
 }
 
 void Trigger::editArgument(unsigned arg_idx, const QString &new_arg)
@@ -124,11 +132,13 @@ void Trigger::editArgument(unsigned arg_idx, const QString &new_arg)
 
 	itr=arguments.begin()+arg_idx;
 	(*itr)=new_arg;
+	setCodeInvalidated();
 }
 
 void Trigger::setExecutePerRow(bool value)
 {
 	is_exec_per_row=value;
+	setCodeInvalidated();
 }
 
 bool Trigger::isExecuteOnEvent(EventType event)
@@ -191,16 +201,20 @@ void Trigger::removeArgument(unsigned arg_idx)
 	vector<QString>::iterator itr;
 	itr=arguments.begin()+arg_idx;
 	arguments.erase(itr);
+	setCodeInvalidated();
 }
 
 void Trigger::removeArguments(void)
 {
 	arguments.clear();
+	setCodeInvalidated();
 }
 
 void Trigger::removeColumns(void)
 {
 	upd_columns.clear();
+
+	setReferencesModified();
 }
 
 void Trigger::setReferecendTable(BaseObject *ref_table)
@@ -210,16 +224,20 @@ void Trigger::setReferecendTable(BaseObject *ref_table)
 		throw Exception(ERR_ASG_OBJECT_INV_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->referenced_table=ref_table;
+
+	setReferencesModified();
 }
 
 void Trigger::setDeferralType(DeferralType tipo)
 {
 	deferral_type=tipo;
+	setCodeInvalidated();
 }
 
 void Trigger::setDeferrable(bool valor)
 {
 	is_deferrable=valor;
+	setCodeInvalidated();
 }
 
 BaseObject *Trigger::getReferencedTable(void)
@@ -297,7 +315,7 @@ void Trigger::setBasicAttributes(unsigned def_type)
 		if(def_type==SchemaParser::SQL_DEFINITION)
 			attributes[ParsersAttributes::TRIGGER_FUNC]=function->getName(true);
 		else
-			attributes[ParsersAttributes::TRIGGER_FUNC]=function->getCodeDefinition(def_type, true);
+			attributes[ParsersAttributes::TRIGGER_FUNC]=getReferenceCodeDefinition(function, def_type);
 	}
 }
 
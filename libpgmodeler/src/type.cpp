@@ -1,10 +1,10 @@
 #include "type.h"
 
-unsigned Type::type_id=50000;
+QAtomicInt Type::type_id(50000);
 
 Type::Type(void)
 {
-	object_id=Type::type_id++;
+	object_id=Type::type_id.fetchAndAddOrdered(1);
 	obj_type=OBJ_TYPE;
 	config=ENUMERATION_TYPE;
 
@@ -98,6 +98,7 @@ void Type::addAttribute(Parameter attrib)
 		throw Exception(ERR_INS_DUPLIC_ITEMS,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	attributes.push_back(attrib);
+	setCodeInvalidated();
 }
 
 void Type::removeAttribute(unsigned attrib_idx)
@@ -107,11 +108,13 @@ void Type::removeAttribute(unsigned attrib_idx)
 		throw Exception(ERR_REF_ATTRIB_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	attributes.erase(attributes.begin() + attrib_idx);
+	setCodeInvalidated();
 }
 
 void Type::removeAttributes(void)
 {
 	attributes.clear();
+	setCodeInvalidated();
 }
 
 bool Type::isEnumerationExists(const QString &enum_name)
@@ -144,6 +147,7 @@ void Type::addEnumeration(const QString &enum_name)
 		throw Exception(ERR_INS_DUPLIC_ENUM_ITEM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	enumerations.push_back(enum_name);
+	setCodeInvalidated();
 }
 
 void Type::removeEnumeration(unsigned enum_idx)
@@ -152,11 +156,13 @@ void Type::removeEnumeration(unsigned enum_idx)
 		throw Exception(ERR_REF_ENUM_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	enumerations.erase(enumerations.begin() + enum_idx);
+	setCodeInvalidated();
 }
 
 void Type::removeEnumerations(void)
 {
 	enumerations.clear();
+	setCodeInvalidated();
 }
 
 void Type::setConfiguration(unsigned conf)
@@ -190,6 +196,7 @@ void Type::setConfiguration(unsigned conf)
 	}
 
 	this->config=conf;
+	setCodeInvalidated();
 }
 
 void Type::setFunction(unsigned func_id, Function *func)
@@ -281,6 +288,8 @@ void Type::setFunction(unsigned func_id, Function *func)
 	}
 
 	functions[func_id]=func;
+
+	setReferencesModified();
 }
 
 void Type::convertFunctionParameters(bool inverse_conv)
@@ -326,11 +335,13 @@ void Type::convertFunctionParameters(bool inverse_conv)
 void Type::setInternalLength(unsigned length)
 {
 	internal_len=length;
+	setCodeInvalidated();
 }
 
 void Type::setByValue(bool value)
 {
 	by_value=value;
+	setCodeInvalidated();
 }
 
 void Type::setAlignment(PgSQLType type)
@@ -341,16 +352,20 @@ void Type::setAlignment(PgSQLType type)
 	if(tp!="char" && tp!="smallint" && tp!="integer" && tp!="double precision")
 		throw Exception(Exception::getErrorMessage(ERR_ASG_INV_ALIGNMENT_TYPE).arg(QString::fromUtf8(this->getName(true))),
 										ERR_ASG_INV_ALIGNMENT_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	setReferencesModified();
 }
 
 void Type::setStorage(StorageType strg)
 {
 	storage=strg;
+	setCodeInvalidated();
 }
 
 void Type::setDefaultValue(const QString &value)
 {
 	this->default_value=value;
+	setCodeInvalidated();
 }
 
 void Type::setElement(PgSQLType elem)
@@ -365,11 +380,14 @@ void Type::setElement(PgSQLType elem)
 										ERR_ASG_INV_ELEMENT_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->element=elem;
+
+	setReferencesModified();
 }
 
 void Type::setDelimiter(char delim)
 {
 	delimiter=delim;
+	setCodeInvalidated();
 }
 
 void Type::setElementsAttribute(unsigned def_type)
@@ -419,11 +437,13 @@ void Type::setEnumerationsAttribute(unsigned def_type)
 void Type::setCategory(CategoryType categ)
 {
 	this->category=categ;
+	setCodeInvalidated();
 }
 
 void Type::setPreferred(bool value)
 {
 	this->preferred=value;
+	setCodeInvalidated();
 }
 
 void Type::setLikeType(PgSQLType like_type)
@@ -433,6 +453,8 @@ void Type::setLikeType(PgSQLType like_type)
 										ERR_USER_TYPE_SELF_REFERENCE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	this->like_type=like_type;
+
+	setReferencesModified();
 }
 
 Parameter Type::getAttribute(unsigned attrib_idx)
@@ -562,8 +584,7 @@ QString Type::getCodeDefinition(unsigned def_type, bool reduced_form)
 					BaseObject::attributes[func_attrib[i]]=functions[i]->getName();
 				else
 				{
-					functions[i]->setAttribute(ParsersAttributes::REF_TYPE, func_attrib[i]);
-					BaseObject::attributes[func_attrib[i]]=functions[i]->getCodeDefinition(def_type, true);
+					BaseObject::attributes[func_attrib[i]]=getReferenceCodeDefinition(functions[i], def_type, func_attrib[i]);
 				}
 			}
 		}
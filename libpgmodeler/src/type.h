@@ -33,7 +33,7 @@
 
 class Type: public BaseObject {
 	private:
-		static unsigned type_id;
+		static QAtomicInt type_id;
 
 		//! \brief Type configuration (BASE | ENUMERATION | COMPOSITE)
 		unsigned config;
@@ -72,7 +72,9 @@ void View::addReference(Reference &refer, unsigned sql_type, int expr_id)
 	col=refer.getColumn();
 	if(col && col->isAddedByRelationship() &&
 		 col->getObjectId() > this->object_id)
-		this->object_id=BaseObject::getGlobalId();
+		this->object_id=BaseObject::generateObjectId();
+
+	setReferencesModified();
 }
 
 unsigned View::getReferenceCount(void)
@@ -151,6 +153,8 @@ void View::removeReference(unsigned ref_id)
 
 	//Removes the reference from the view
 	references.erase(references.begin() + ref_id);
+
+	setReferencesModified();
 }
 
 void View::removeReferences(void)
@@ -159,6 +163,8 @@ void View::removeReferences(void)
 	exp_select.clear();
 	exp_from.clear();
 	exp_where.clear();
+
+	setReferencesModified();
 }
 
 void View::removeReference(unsigned expr_id, unsigned sql_type)
@@ -169,6 +175,8 @@ void View::removeReference(unsigned expr_id, unsigned sql_type)
 		throw Exception(ERR_REF_OBJ_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	vect_idref->erase(vect_idref->begin() + expr_id);
+
+	setReferencesModified();
 }
 
 int View::getReferenceIndex(Reference &ref, unsigned sql_type)
@@ -108,8 +108,8 @@ void BaseConfigWidget::loadConfiguration(const QString &conf_id, const vector<QS
 	try
 	{
 		config_params.clear();
-		XMLParser::restartParser();
-		XMLParser::setDTDFile(GlobalAttributes::CONFIGURATIONS_DIR +
+		xmlparser.restartParser();
+		xmlparser.setDTDFile(GlobalAttributes::CONFIGURATIONS_DIR +
 													GlobalAttributes::DIR_SEPARATOR +
 													GlobalAttributes::OBJECT_DTD_DIR +
 													GlobalAttributes::DIR_SEPARATOR +
@@ -117,35 +117,35 @@ void BaseConfigWidget::loadConfiguration(const QString &conf_id, const vector<QS
 													GlobalAttributes::OBJECT_DTD_EXT,
 													conf_id);
 
-		XMLParser::loadXMLFile(GlobalAttributes::CONFIGURATIONS_DIR +
+		xmlparser.loadXMLFile(GlobalAttributes::CONFIGURATIONS_DIR +
 													 GlobalAttributes::DIR_SEPARATOR +
 													 conf_id +
 													 GlobalAttributes::CONFIGURATION_EXT);
 
-		if(XMLParser::accessElement(XMLParser::CHILD_ELEMENT))
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
 			do
 			{
-				if(XMLParser::getElementType()==XML_ELEMENT_NODE)
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
 					this->getConfigurationParams(key_attribs);
 
-					if(XMLParser::hasElement(XMLParser::CHILD_ELEMENT))
+					if(xmlparser.hasElement(XMLParser::CHILD_ELEMENT))
 					{
-						XMLParser::savePosition();
-						XMLParser::accessElement(XMLParser::CHILD_ELEMENT);
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
 
 						do
 						{
 							this->getConfigurationParams(key_attribs);
 						}
-						while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+						while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 
-						XMLParser::restorePosition();
+						xmlparser.restorePosition();
 					}
 				}
 			}
-			while(XMLParser::accessElement(XMLParser::NEXT_ELEMENT));
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
@@ -160,7 +160,7 @@ void BaseConfigWidget::getConfigurationParams(const vector<QString> &key_attribs
 	map<QString, QString>::iterator itr, itr_end;
 	QString key;
 
-	XMLParser::getElementAttributes(aux_attribs);
+	xmlparser.getElementAttributes(aux_attribs);
 
 	itr=aux_attribs.begin();
 	itr_end=aux_attribs.end();
@@ -174,7 +174,7 @@ void BaseConfigWidget::getConfigurationParams(const vector<QString> &key_attribs
 	}
 
 	if(key.isEmpty())
-		key=XMLParser::getElementName();
+		key=xmlparser.getElementName();
 
 	if(!aux_attribs.empty())
 		config_params[key]=aux_attribs;
@@ -37,6 +37,9 @@ class BaseConfigWidget {
 		 is the current attribute value */
 		map<QString, map<QString, QString> > config_params;
 
+		//! \brief Parser used to read the configuration files
+		XMLParser xmlparser;
+
 		/*! \brief Saves the configuration on file. The conf_id param indicates the type of
 		 configuration to be saved. (see GlobalAttributes::*_CONF) */
 		void saveConfiguration(const QString &conf_id);
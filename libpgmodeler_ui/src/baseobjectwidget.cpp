@@ -598,8 +598,10 @@ void BaseObjectWidget::finishConfiguration(void)
 			new_object=false;
 		}
 		else
+		{
 			//If the object is being updated, validates its SQL definition
 			model->validateObjectDefinition(this->object, SchemaParser::SQL_DEFINITION);
+		}
 
 		this->accept();
 		parent_form->hide();
@@ -790,8 +790,8 @@ void ModeloWidget::converterRelacionamentoNN(void)
 					xml_tab=tab_nn->getCodeDefinition(SchemaParser::XML_DEFINITION);
 
 					//Cria a mesma a partir do xml
-					XMLParser::restartParser();
-					XMLParser::loadXMLBuffer(xml_tab);
+					modelo->getXMLParser()->restartParser();
+					modelo->getXMLParser()->loadXMLBuffer(xml_tab);
 					tab=modelo->createTable();
 					nome_tab=tab->getName();
 
@@ -915,13 +915,22 @@ void ModeloWidget::carregarModelo(const QString &nome_arq)
 {
 	try
 	{
+		bool confiavel;
+
 		//Configura o widget de progresso para exibir o progresso de carregamento do modelo
 		connect(modelo, SIGNAL(s_objectLoaded(int,QString,unsigned)), task_prog_wgt, SLOT(updateProgress(int,QString,unsigned)));
 		task_prog_wgt->setWindowTitle(trUtf8("Loading database model"));
 		task_prog_wgt->show();
 
-		//Carrega o arquivo
-		modelo->loadModel(nome_arq);
+		/* Os modelos temporários (salvamento automático) são gerados pelo próprio pgModeler e não precisam
+			 ser validados contra o DTD caso o checksum do arquivo seja válido */
+		confiavel=QFileInfo(nome_arq).absolutePath()==QFileInfo(GlobalAttributes::TEMPORARY_DIR).absoluteFilePath();
+
+		//Carrega o arquivo (arquivos grandes são lidos elemento a elemento)
+		if(QFile(nome_arq).size() >= DatabaseModel::STREAM_LOAD_MIN_SIZE)
+			modelo->loadModelStream(nome_arq, confiavel);
+		else
+			modelo->loadModel(nome_arq, confiavel);
 		this->nome_arquivo=nome_arq;
 
 		//Ajusta o tamanho da cena
@@ -1692,7 +1701,7 @@ void ModeloWidget::copiarObjetos(void)
 	vector<unsigned> id_objs;
 	vector<BaseObject *>::iterator itr, itr_end;
 	vector<unsigned>::iterator itr1, itr1_end;
-	vector<BaseObject *> vet_deps;
+	vector<BaseObject *> vet_deps, vet_objs;
 	BaseObject *objeto=NULL;
 	TableObject *obj_tab=NULL;
 	Table *tabela=NULL;
@@ -1716,47 +1725,55 @@ void ModeloWidget::copiarObjetos(void)
 	itr=objs_selecionados.begin();
 	itr_end=objs_selecionados.end();
 
+	//Relacionamentos Tabela-visão não são copiados pois são criados automaticamente pelo modelo
+	while(itr!=itr_end)
+	{
+		if((*itr)->getObjectType()!=BASE_RELATIONSHIP)
+			vet_objs.push_back(*itr);
+		itr++;
+	}
+
+	/* Obtém as dependências de todos os objetos de uma só vez caso o usuário tenha
+		confirmado a obtenção das mesmas, assim os objetos em comum são visitados uma única vez */
+	modelo->getObjectDependecies(vet_objs, vet_deps, caixa_msg->result()==QDialog::Accepted);
+
+	itr=vet_objs.begin();
+	itr_end=vet_objs.end();
+
 	//Varre a lista de objetos selecionados
 	while(itr!=itr_end)
 	{
 		objeto=(*itr);
 
-		//Relacionamentos Tabela-visão não são copiados pois são criados automaticamente pelo modelo
-		if(objeto->getObjectType()!=BASE_RELATIONSHIP)
+		/* Caso especial para tabelas: É preciso copiar para a lista os objetos especiais
+		(indices, gatilhos e restrições) que referenciam colunas incluídas por relacionamento.
+		Para que seja possível a recriação dos mesmos quando colados */
+		if(objeto->getObjectType()==OBJ_TABLE)
 		{
-			//Obtém as dependências do objeto atual caso o usuário tenha confirmado a obtenção das mesmas
-			modelo->getObjectDependecies(objeto, vet_deps, caixa_msg->result()==QDialog::Accepted);
+			tabela=dynamic_cast<Table *>(objeto);
 
-			/* Caso especial para tabelas: É preciso copiar para a lista os objetos especiais
-			(indices, gatilhos e restrições) que referenciam colunas incluídas por relacionamento.
-			Para que seja possível a recriação dos mesmos quando colados */
-			if(objeto->getObjectType()==OBJ_TABLE)
+			for(id_tipo=0; id_tipo < 3; id_tipo++)
 			{
-				tabela=dynamic_cast<Table *>(objeto);
+				//Varre cada lista de objetos especiais validando-os e inserindo-os na lista de dependências
+				qtd=tabela->getObjectCount(tipos[id_tipo]);
 
-				for(id_tipo=0; id_tipo < 3; id_tipo++)
+				for(i=0; i < qtd; i++)
 				{
-					//Varre cada lista de objetos especiais validando-os e inserindo-os na lista de dependências
-					qtd=tabela->getObjectCount(tipos[id_tipo]);
-
-					for(i=0; i < qtd; i++)
-					{
-						//Obtém um objeto especial
-						obj_tab=dynamic_cast<TableObject *>(tabela->getObject(i, tipos[id_tipo]));
-						constr=dynamic_cast<Constraint *>(obj_tab);
-
-						/* O objeto só será incluído na lista se o mesmo não foi incluído por relacionamento mas
-				 referencia colunas incluídas por relacionamento. Caso se tratar de uma restrição, a mesma
-				 não pode ser chave primária pois estas são tratadas separadamente nos relacionamentos */
-						if(!obj_tab->isAddedByRelationship() &&
-							 ((constr &&
-								 (constr->getConstraintType()==ConstraintType::foreign_key ||
-									(constr->getConstraintType()==ConstraintType::unique &&
-									 constr->isReferRelationshipAddedColumn()))) ||
-								(tipos[id_tipo]==OBJ_TRIGGER && dynamic_cast<Trigger *>(obj_tab)->isReferRelationshipAddedColumn()) ||
-								(tipos[id_tipo]==OBJ_INDEX && dynamic_cast<Index *>(obj_tab)->isReferRelationshipAddedColumn())))
-							vet_deps.push_back(obj_tab);
-					}
+					//Obtém um objeto especial
+					obj_tab=dynamic_cast<TableObject *>(tabela->getObject(i, tipos[id_tipo]));
+					constr=dynamic_cast<Constraint *>(obj_tab);
+
+					/* O objeto só será incluído na lista se o mesmo não foi incluído por relacionamento mas
+			 referencia colunas incluídas por relacionamento. Caso se tratar de uma restrição, a mesma
+			 não pode ser chave primária pois estas são tratadas separadamente nos relacionamentos */
+					if(!obj_tab->isAddedByRelationship() &&
+						 ((constr &&
+							 (constr->getConstraintType()==ConstraintType::foreign_key ||
+								(constr->getConstraintType()==ConstraintType::unique &&
+								 constr->isReferRelationshipAddedColumn()))) ||
+							(tipos[id_tipo]==OBJ_TRIGGER && dynamic_cast<Trigger *>(obj_tab)->isReferRelationshipAddedColumn()) ||
+							(tipos[id_tipo]==OBJ_INDEX && dynamic_cast<Index *>(obj_tab)->isReferRelationshipAddedColumn())))
+						vet_deps.push_back(obj_tab);
 				}
 			}
 		}
@@ -1995,14 +2012,14 @@ void ModeloWidget::colarObjetos(void)
 	while(itr!=itr_end)
 	{
 		//Carrega o parser xml com o buffer
-		XMLParser::restartParser();
-		XMLParser::loadXMLBuffer(xml_objs[*itr]);
+		modelo->getXMLParser()->restartParser();
+		modelo->getXMLParser()->loadXMLBuffer(xml_objs[*itr]);
 		itr++;
 
 		try
 		{
 			//Cria um objeto com o xml obtido
-			objeto=modelo->createObject(modelo->getObjectType(XMLParser::getElementName()));
+			objeto=modelo->createObject(modelo->getObjectType(modelo->getXMLParser()->getElementName()));
 			obj_tab=dynamic_cast<TableObject *>(objeto);
 			constr=dynamic_cast<Constraint *>(obj_tab);
 
@@ -337,10 +337,8 @@ void VisaoObjetosWidget::atualizarListaObjetos(void)
 					else if(tipos[id_tipo]==OBJ_FUNCTION)
 					{
 						funcao=dynamic_cast<Function *>(objeto);
-						funcao->createSignature(false);
-						item_tab->setText(QString::fromUtf8(funcao->getSignature()));
-						item_tab->setToolTip(QString::fromUtf8(funcao->getSignature()));
-						funcao->createSignature(true);
+						item_tab->setText(QString::fromUtf8(funcao->getSignature(false)));
+						item_tab->setToolTip(QString::fromUtf8(funcao->getSignature(false)));
 					}
 					else
 					{
@@ -689,14 +687,10 @@ void VisaoObjetosWidget::atualizarSubArvoreEsquema(QTreeWidgetItem *raiz)
 							if(tipos[i1]==OBJ_FUNCTION)
 							{
 								funcao=dynamic_cast<Function *>(objeto);
-								//Cria a assinatura sem formatar o nome
-								funcao->createSignature(false);
-								//O texto do ítem será a assinatura da função e não o nome do objeto
-								item4->setText(0,QString::fromUtf8(funcao->getSignature()));
-								item4->setToolTip(0,QString::fromUtf8(funcao->getSignature()));
-								/* Cria a assinatura formatando o nome, para não quebrar possíveis
-					 referências a esse objeto */
-								funcao->createSignature(true);
+								/* O texto do ítem será a assinatura da função (sem formatar o nome) e não o nome do objeto.
+									 A assinatura armazenada não é alterada para não invalidar referências a esse objeto */
+								item4->setText(0,QString::fromUtf8(funcao->getSignature(false)));
+								item4->setToolTip(0,QString::fromUtf8(funcao->getSignature(false)));
 							}
 							else if(tipos[i1]==OBJ_OPERATOR)
 							{
@@ -122,6 +122,9 @@ int main(int argc, char **argv)
 		splash.show();
 		splash.repaint();
 
+		//Compiles the schema files while the splash is shown so the code generation doesn't need to parse them
+		SchemaParser::precompileSchemas();
+
 		//Creates the main form
 		FormPrincipal fmain;
 		app.setMainWidget(&fmain);